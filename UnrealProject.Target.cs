@@ -11,5 +11,7 @@ public class UnrealProjectTarget : TargetRules
 		DefaultBuildSettings = BuildSettingsVersion.V5;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_6;
 		ExtraModuleNames.Add("UnrealProject");
+		bUseIris = true;
+		bWithPushModel = true;
 	}
 }
@@ -9,13 +9,15 @@
 // Sets default values
 AInteractableDummy::AInteractableDummy()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 
+	// 종류 값 하나만 복제. 메시는 클래스 기본값이라 컴포넌트 복제 불필요
 	SetReplicateMovement(false);
+	bNetLoadOnClient = true;
+	SetNetCullDistanceSquared(FMath::Square(NSNet::WorkCullDistance));
 
 	Mesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Mesh"));
 	SetRootComponent(Mesh);
-	Mesh->SetIsReplicated(true);
 
 }
 
@@ -28,6 +30,7 @@ void AInteractableDummy::SetKind_Server(EInteractableKind NewKind)
 {
 	if (HasAuthority())
 	{
+		FlushNetDormancy();
 		Kind = NewKind;
 		OnRep_Kind();
 	}
@@ -29,7 +29,7 @@ public:
 	UFUNCTION(BlueprintCallable)
 	EInteractableKind GetKind() const { return Kind; }
 
-	//  
+	// 서버에서만 변경
 	void SetKind_Server(EInteractableKind NewKind);
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
@@ -16,13 +16,21 @@
 #include "TimerManager.h"
 
 #include "NSGameModeBase.h"
+#include "NSTypes.h"
 
 AInteractiveActor::AInteractiveActor()
 {
 	PrimaryActorTick.bCanEverTick = false;
 
 	bReplicates = true;                
-	SetReplicateMovement(true);
+	// 수리 대상은 움직이지 않음: 이동/컴포넌트 복제 없이 상태 3개만.
+	// 레벨 배치본은 클라가 맵에서 직접 로드(안정 이름으로 주소 지정)하고 처음부터 휴면
+	SetReplicateMovement(false);
+	bNetLoadOnClient = true;
+	NetDormancy = DORM_Initial;
+	// 고장 상태/진행도는 멀리서도 보이게. NetPriority는 레거시 전용 (Iris 우선순위는 DefaultEngine.ini)
+	SetNetCullDistanceSquared(FMath::Square(NSNet::RepairCullDistance));
+	NetPriority = 2.f;
 
 	Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
 	SetRootComponent(Root);
@@ -141,8 +149,10 @@ void AInteractiveActor::Server_StopRepair_Implementation(APlayerCharacter* By)
 
 	GetWorldTimerManager().ClearTimer(TimerPrompt);
 	GetWorldTimerManager().ClearTimer(TimerTimeout);
+	GetWorldTimerManager().ClearTimer(TimerResend);
+	CurrentPromptIndex = FQTEPromptMsg::NoKey;
 
-	bInQTEMode = false;
+	NS_SET_DIRTY(AInteractiveActor, bInQTEMode, false);
 
 
 	// 모든 클라에서 몽타주 정지
@@ -152,14 +162,41 @@ void AInteractiveActor::Server_StopRepair_Implementation(APlayerCharacter* By)
 		Client_EndQTE();
 
 	OnRep_InQTEMode(); // 패널 복귀
+	UpdateNetDormancy();
+}
+
+void AInteractiveActor::UpdateNetDormancy()
+{
+	if (!HasAuthority()) return;
+
+	if (bInQTEMode)
+	{
+		// QTE 동안은 진행도/소유자 RPC가 잦으니 깨어 있음
+		SetNetDormancy(DORM_Awake);
+		return;
+	}
+
+	// 바뀐 상태를 한 번 보낸 뒤 다시 휴면 (이미 휴면이면 Flush가 1회 복제, 깨어 있으면 마지막 변경 후 휴면)
+	FlushNetDormancy();
+	SetNetDormancy(DORM_DormantAll);
 }
 
 void AInteractiveActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(AInteractiveActor, bIsBroken);
-	DOREPLIFETIME(AInteractiveActor, RepairProgress);
-	DOREPLIFETIME(AInteractiveActor, bInQTEMode);
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AInteractiveActor, bIsBroken, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AInteractiveActor, RepairProgress, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AInteractiveActor, bInQTEMode, Params);
+}
+
+void AInteractiveActor::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+#if NS_VALIDATE_PUSH_MODEL
+	PushValidator.Validate(this, AInteractiveActor::StaticClass());
+#endif
 }
 
 void AInteractiveActor::OnRep_IsBroken()
@@ -179,9 +216,16 @@ void AInteractiveActor::OnRep_RepairProgress()
 void AInteractiveActor::SetIsBroken(bool bNew)
 {
 	if (!HasAuthority()) return;
-	bIsBroken = bNew;
-	if (!bIsBroken) { RepairProgress = 0.f; bInQTEMode = false; }
+	const bool bChanged = (bIsBroken != bNew);
+	NS_SET_DIRTY(AInteractiveActor, bIsBroken, bNew);
+	if (!bIsBroken)
+	{
+		NS_SET_DIRTY(AInteractiveActor, RepairProgress, 0.f);
+		NS_SET_DIRTY(AInteractiveActor, bInQTEMode, false);
+	}
+	UpdateNetDormancy();
 	OnRep_IsBroken();
+	if (bChanged) OnBrokenChangedNative.Broadcast(this, bIsBroken);
 }
 
 void AInteractiveActor::StartRepair()
@@ -200,10 +244,12 @@ void AInteractiveActor::Server_RequestStartRepair_Implementation(APlayerCharacte
 	QTEOwnerPC = By ? Cast<APlayerController>(By->GetController()) : nullptr;
 	if (!QTEOwnerPC.IsValid()) return;
 
-	SetOwner(QTEOwnerPC.Get());
+	// 휴면 상태에서 소유자를 바꾸면 Owner 변경이 복제되지 않으므로 먼저 깨운다
+	NS_SET_DIRTY(AInteractiveActor, bInQTEMode, true);
+	NS_SET_DIRTY(AInteractiveActor, RepairProgress, 0.f);
+	UpdateNetDormancy();
 
-	bInQTEMode = true;
-	RepairProgress = 0.f;
+	SetOwner(QTEOwnerPC.Get());
 
     // 모든 클라이언트에 몽타주 재생
     if (By) By->Multicast_PlayRepairMontage(true);
@@ -227,44 +273,85 @@ void AInteractiveActor::IssuePrompt()
 	if (!HasAuthority() || !bInQTEMode) return;
 	if (QTE.Keys.Num() == 0) return;
 
-	CurrentPromptKey = QTE.Keys[FMath::RandHelper(QTE.Keys.Num())];
+	// 인덱스는 uint8, NoKey(255)는 지우기 전용
+	CurrentPromptIndex = uint8(FMath::RandHelper(FMath::Min(QTE.Keys.Num(), int32(FQTEPromptMsg::NoKey))));
 
-	if (APlayerController* PC = QTEOwnerPC.Get())
+	// 이전 프롬프트 제거 + 새 프롬프트 표시를 한 메시지로
+	SendPromptMsg();
+
+	GetWorldTimerManager().SetTimer(TimerTimeout, this, &AInteractiveActor::ApplyFail, QTE.PromptTimeout, false);
+}
+
+void AInteractiveActor::SendPromptMsg()
+{
+	FQTEPromptMsg Msg;
+	Msg.Seq = NextMsgSeq++;
+	Msg.KeyIndex = CurrentPromptIndex;
+	Msg.SetTimeout(QTE.PromptTimeout);
+	Msg.SetProgress(RepairProgress);
+	if (CurrentPromptIndex != FQTEPromptMsg::NoKey)
 	{
-		// 남아있을 수 있는 이전 프롬프트 제거
-		Client_ClearPrompt();
-		// 새 프롬프트 표시
-		Client_ShowPrompt(CurrentPromptKey, QTE.PromptTimeout);
+		CurrentPromptSeq = Msg.Seq;
 	}
+	LastPromptMsg = Msg;
 
-	GetWorldTimerManager().SetTimer(TimerTimeout, this, &AInteractiveActor::ApplyFail, QTE.PromptTimeout, false);
+	if (QTEOwnerPC.IsValid())
+	{
+		Client_QTEPrompt(Msg);
+	}
+
+	// 프롬프트든 지우기/진행도든 다음 메시지가 대체할 때까지 재전송
+	GetWorldTimerManager().SetTimer(TimerResend, this, &AInteractiveActor::ResendPrompt, QTE.PromptResendInterval, true);
+}
+
+void AInteractiveActor::ResendPrompt()
+{
+	if (!HasAuthority() || !bInQTEMode || !QTEOwnerPC.IsValid()) return;
+
+	// 같은 Seq라 이미 받은 클라는 버림. 진행도는 메시지 사이에 바뀌지 않으니 열린 프롬프트의 남은 시간만 갱신
+	FQTEPromptMsg Msg = LastPromptMsg;
+	if (Msg.KeyIndex != FQTEPromptMsg::NoKey)
+	{
+		Msg.SetTimeout(GetWorldTimerManager().GetTimerRemaining(TimerTimeout));
+	}
+	Client_QTEPrompt(Msg);
 }
 
+void AInteractiveActor::SubmitQTEInput(FKey Pressed)
+{
+	// 프롬프트를 받은 적 없으면 보낼 게 없음
+	if (!bLocalHasMsg) return;
+
+	const int32 Index = QTE.Keys.IndexOfByKey(Pressed);
+	const uint8 KeyIndex = (Index == INDEX_NONE || Index >= FQTEPromptMsg::NoKey) ? FQTEPromptMsg::NoKey : uint8(Index);
+	Server_SubmitQTEInput(KeyIndex, LocalPromptSeq);
+}
 
-void AInteractiveActor::Server_SubmitQTEInput_Implementation(FKey Pressed)
+void AInteractiveActor::Server_SubmitQTEInput_Implementation(uint8 KeyIndex, uint8 PromptSeq)
 {
-	UE_LOG(LogTemp, Warning, TEXT("[Server] %s SubmitQTEInput: %s (Owner=%s)"),
-		*GetName(), *Pressed.ToString(), *GetNameSafe(GetOwner()));
+	UE_LOG(LogTemp, Verbose, TEXT("[QTE] %s submit key=%d seq=%d (open=%d/%d)"),
+		*GetName(), KeyIndex, PromptSeq, CurrentPromptIndex, CurrentPromptSeq);
 
 	if (!HasAuthority() || !bInQTEMode) return;
 
+	// 이미 처리된(시간 초과/이전) 프롬프트에 대한 늦은 입력은 무시
+	if (CurrentPromptIndex == FQTEPromptMsg::NoKey || PromptSeq != CurrentPromptSeq) return;
+
 	GetWorldTimerManager().ClearTimer(TimerTimeout);
 
-	if (Pressed == CurrentPromptKey) ApplySuccess();
-	else                             ApplyFail();
+	if (KeyIndex == CurrentPromptIndex) ApplySuccess();
+	else                                ApplyFail();
 
 	if (bInQTEMode) ScheduleNextPrompt(); // 완료 전이라면 다음 프롬프트 예약
 }
 
 void AInteractiveActor::ApplySuccess()
 {
-	RepairProgress = FMath::Clamp(RepairProgress + QTE.SuccessGain, 0.f, 1.f);
-
-	// 소유 클라 UI 갱신
-	Client_UpdateProgress(RepairProgress);
+	NS_SET_DIRTY(AInteractiveActor, RepairProgress, FMath::Clamp(RepairProgress + QTE.SuccessGain, 0.f, 1.f));
 
-	// 현재 프롬프트 제거
-	Client_ClearPrompt();
+	// 현재 프롬프트 제거 + 소유 클라 진행도 갱신 (다음 프롬프트까지 재전송)
+	CurrentPromptIndex = FQTEPromptMsg::NoKey;
+	SendPromptMsg();
 
 	// 다른 클라 갱신은 OnRep이 처리
 	OnRep_RepairProgress();
@@ -276,13 +363,11 @@ void AInteractiveActor::ApplyFail()
 {
 	if (!HasAuthority() || !bInQTEMode) return;
 
-	RepairProgress = FMath::Clamp(RepairProgress - QTE.FailPenalty, 0.f, 1.f);
+	NS_SET_DIRTY(AInteractiveActor, RepairProgress, FMath::Clamp(RepairProgress - QTE.FailPenalty, 0.f, 1.f));
 
-	// 소유 클라 UI 갱신
-	Client_UpdateProgress(RepairProgress);
-
-	// 현재 프롬프트 제거
-	Client_ClearPrompt();
+	// 현재 프롬프트 제거 + 소유 클라 진행도 갱신 (다음 프롬프트까지 재전송)
+	CurrentPromptIndex = FQTEPromptMsg::NoKey;
+	SendPromptMsg();
 
 	OnRep_RepairProgress();
 
@@ -293,8 +378,10 @@ void AInteractiveActor::CompleteRepair()
 {
 	GetWorldTimerManager().ClearTimer(TimerPrompt);
 	GetWorldTimerManager().ClearTimer(TimerTimeout);
+	GetWorldTimerManager().ClearTimer(TimerResend);
+	CurrentPromptIndex = FQTEPromptMsg::NoKey;
 
-	bInQTEMode = false;
+	NS_SET_DIRTY(AInteractiveActor, bInQTEMode, false);
 	// 모든 클라에서 몽타주 정지
 	if (APlayerController* PC = QTEOwnerPC.Get())
 		if (auto* P = Cast<APlayerCharacter>(PC->GetPawn()))
@@ -325,22 +412,33 @@ void AInteractiveActor::OnRep_InQTEMode()
 	}
 }
 
-void AInteractiveActor::Client_UpdateProgress_Implementation(float NewProgress)
+void AInteractiveActor::Client_QTEPrompt_Implementation(FQTEPromptMsg Msg)
 {
+	// 비신뢰라 순서가 뒤바뀔 수 있음: 마지막으로 받은 것보다 오래된 메시지는 버림 (uint8 순환 비교)
+	// 같은 Seq는 이미 반영한 메시지의 재전송이므로 역시 버림. 원본이 유실됐으면 재전송이 처음 도착한 것
+
+	if (bLocalHasMsg && int8(Msg.Seq - LocalMsgSeq) <= 0) return;
+	bLocalHasMsg = true;
+	LocalMsgSeq = Msg.Seq;
+
 	// BP가 진행도 Bar를 안전하게 갱신(ProgressBar가 아직 없다면 BP에서 IsValid 체크)
-	OnRepairProgressUpdated(NewProgress);
-}
+	OnRepairProgressUpdated(Msg.GetProgress());
 
-void AInteractiveActor::Client_ClearPrompt_Implementation()
-{
 	// BP에서 현재 떠 있는 QTE 아이콘 RemoveFromParent 등으로 정리
 	BP_OnQTEClearPrompt();
+
+	if (QTE.Keys.IsValidIndex(Msg.KeyIndex))
+	{
+		LocalPromptSeq = Msg.Seq;
+		BP_OnQTEPrompt(QTE.Keys[Msg.KeyIndex], Msg.GetTimeout());
+	}
 }
 
 
 void AInteractiveActor::Client_BeginQTE_Implementation(APlayerController* ForPC) 
 { 
 	LocalQTEPC = ForPC;
+	bLocalHasMsg = false;
 
 	// 입력/포커스 안전 설정 (BP에서도 하겠지만 여기서 보강)
 	if (ForPC)
@@ -361,7 +459,6 @@ void AInteractiveActor::Client_BeginQTE_Implementation(APlayerController* ForPC)
 	// UI가 막 생성된 직후, 진행도 0
 	OnRepairProgressUpdated(RepairProgress);
 }
-void AInteractiveActor::Client_ShowPrompt_Implementation(FKey Key, float Timeout) { BP_OnQTEPrompt(Key, Timeout); }
 void AInteractiveActor::Client_EndQTE_Implementation()
 {
 	if (LocalQTEPC.IsValid())
@@ -379,7 +476,8 @@ void AInteractiveActor::Client_EndQTE_Implementation()
 		LocalQTEPC->bShowMouseCursor = false;
 	}
 
-	Client_ClearPrompt();
+	BP_OnQTEClearPrompt();
 	BP_OnQTEEnd();
 	LocalQTEPC = nullptr;
+	bLocalHasMsg = false;
 }
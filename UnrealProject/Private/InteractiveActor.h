@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "InputCoreTypes.h"
+#include "NSPushModel.h"
 #include "InteractiveActor.generated.h"
 
 class UWidgetComponent;
@@ -15,12 +16,37 @@ struct FQTEConfig
     GENERATED_BODY()
     UPROPERTY(EditAnywhere) float PromptInterval = 1.5f;
     UPROPERTY(EditAnywhere) float PromptTimeout = 1.25f;
+    UPROPERTY(EditAnywhere) float PromptResendInterval = 0.2f; // 입력이 올 때까지 같은 Seq로 재전송
     UPROPERTY(EditAnywhere) float SuccessGain = 0.25f; // 진행도 +
     UPROPERTY(EditAnywhere) float FailPenalty = 0.10f; // 진행도 -
     UPROPERTY(EditAnywhere) TArray<FKey> Keys = { EKeys::Q, EKeys::W, EKeys::E, EKeys::R };
 };
 
+// 서버 → 소유 클라 QTE 메시지 하나 (프롬프트 표시/지우기 + 진행도). 4바이트, 비신뢰 전송
+USTRUCT()
+struct FQTEPromptMsg
+{
+    GENERATED_BODY()
+
+    static constexpr uint8 NoKey = 0xFF;       // 프롬프트 지우기만
+    static constexpr float TimeoutStep = 0.05f; // 최대 12.75초
+
+    // 메시지마다 증가 (재전송은 같은 값). 클라는 이미 받았거나 오래된 메시지를 버림
+    UPROPERTY() uint8 Seq = 0;
+    // FQTEConfig::Keys 인덱스
+    UPROPERTY() uint8 KeyIndex = NoKey;
+    UPROPERTY() uint8 TimeoutQ = 0;
+    UPROPERTY() uint8 ProgressQ = 0;
+
+    float GetTimeout() const { return TimeoutQ * TimeoutStep; }
+    float GetProgress() const { return ProgressQ / 255.f; }
+    void SetTimeout(float Sec) { TimeoutQ = uint8(FMath::Clamp(FMath::RoundToInt(Sec / TimeoutStep), 0, 255)); }
+    void SetProgress(float P) { ProgressQ = uint8(FMath::Clamp(FMath::RoundToInt(P * 255.f), 0, 255)); }
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRepairCompleted, AInteractiveActor*, Who);
+// 서버 전용 네이티브 알림: 고장 상태가 실제로 바뀔 때만 (SpawnDirector 풀 인덱스 갱신용)
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnBrokenChangedNative, AInteractiveActor* /*Who*/, bool /*bNewBroken*/);
 
 UCLASS()
 class AInteractiveActor : public AActor
@@ -31,7 +57,9 @@ public:
     AInteractiveActor();
 
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+    virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
 
+    // 복제 속성은 푸시 모델: 서버에서 바꿀 때 NS_SET_DIRTY/NS_MARK_DIRTY 필수
     UPROPERTY(ReplicatedUsing = OnRep_IsBroken, VisibleAnywhere, BlueprintReadOnly, Category = "State")
     bool bIsBroken = true;
 
@@ -56,26 +84,24 @@ public:
     UPROPERTY(Transient, BlueprintReadOnly, Category = "Repair|QTE")
     TWeakObjectPtr<APlayerController> LocalQTEPC;
 
-    UPROPERTY(VisibleInstanceOnly, Category = "Repair|QTE")
-    FKey CurrentPromptKey;
-
-    FTimerHandle TimerPrompt, TimerTimeout;
+    FTimerHandle TimerPrompt, TimerTimeout, TimerResend;
 
-    UFUNCTION(Client, Reliable)
-    void Client_UpdateProgress(float NewProgress);
-
-    UFUNCTION(Client, Reliable)
-    void Client_ClearPrompt(); // 화면의 QTE 아이콘 제거 요청
+    // 프롬프트 표시/지우기/진행도를 한 메시지로. 비신뢰: 마지막 메시지를 다음 메시지가 나올 때까지 재전송
+    UFUNCTION(Client, Unreliable)
+    void Client_QTEPrompt(FQTEPromptMsg Msg);
 
     // BP에서 실제 위젯 제거/정리만 수행
     UFUNCTION(BlueprintImplementableEvent)
     void BP_OnQTEClearPrompt();
 
     UFUNCTION(Server, Reliable, BlueprintCallable) void Server_RequestStartRepair(class APlayerCharacter* By);
-    UFUNCTION(Server, Reliable, BlueprintCallable) void Server_SubmitQTEInput(FKey Pressed);
+
+    // 소유 클라(위젯)에서 호출: 누른 키를 현재 프롬프트 번호와 함께 인덱스로 보냄
+    UFUNCTION(BlueprintCallable, Category = "Repair|QTE") void SubmitQTEInput(FKey Pressed);
+    // 키가 목록에 없으면 KeyIndex = NoKey (오답 처리). 키 입력당 1회라 신뢰 전송 (유실되면 시간 초과로 실패 처리됨)
+    UFUNCTION(Server, Reliable) void Server_SubmitQTEInput(uint8 KeyIndex, uint8 PromptSeq);
 
     UFUNCTION(Client, Reliable) void Client_BeginQTE(class APlayerController* ForPC);
-    UFUNCTION(Client, Reliable) void Client_ShowPrompt(FKey Key, float Timeout);
     UFUNCTION(Client, Reliable) void Client_EndQTE();
 
     UFUNCTION(BlueprintImplementableEvent) void BP_OnQTEBegin(APlayerController* ForPC);
@@ -84,6 +110,7 @@ public:
     UFUNCTION(BlueprintImplementableEvent) void BP_OnBrokenChanged(bool bNewBroken);
 
     UPROPERTY(BlueprintAssignable) FOnRepairCompleted OnRepairCompleted;
+    FOnBrokenChangedNative OnBrokenChangedNative;
 
     // 기존 인터페이스 유지
     UFUNCTION(BlueprintCallable) void SetIsBroken(bool bNewState);
@@ -103,8 +130,15 @@ protected:
     UFUNCTION()
     void OnRep_InQTEMode();
 
+    // 서버: QTE 중에만 깨어 있고 그 외엔 휴면 (상태 변경 시 1회 Flush)
+    void UpdateNetDormancy();
+
     void ScheduleNextPrompt();
     void IssuePrompt();
+    // 서버: 현재 프롬프트(없으면 지우기)와 진행도를 소유 클라에 전송
+    void SendPromptMsg();
+    // 서버: 마지막 메시지를 같은 Seq로 다시 전송 (유실 대비). 열린 프롬프트면 남은 시간으로
+    void ResendPrompt();
     void ApplySuccess();
     void ApplyFail();
     void CompleteRepair();
@@ -145,4 +179,21 @@ public:
     UFUNCTION(BlueprintPure, Category = "UI")
     UUserWidget* GetPanelWidget() const;
 
+private:
+    // 서버: 현재 열린 프롬프트 (NoKey면 입력 대기 아님)와 그 메시지 번호
+    uint8 CurrentPromptIndex = FQTEPromptMsg::NoKey;
+    uint8 CurrentPromptSeq = 0;
+    uint8 NextMsgSeq = 0;
+    // 서버: 마지막으로 보낸 메시지 (재전송용)
+    FQTEPromptMsg LastPromptMsg;
+
+    // 소유 클라: 마지막으로 받은 메시지/프롬프트 번호
+    uint8 LocalMsgSeq = 0;
+    uint8 LocalPromptSeq = 0;
+    bool bLocalHasMsg = false;
+
+#if NS_VALIDATE_PUSH_MODEL
+    FNSPushModelValidator PushValidator;
+    friend class FNSPushModelTest;   // Tests/NSPushModelTest.cpp
+#endif
 };
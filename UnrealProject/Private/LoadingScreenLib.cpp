@@ -14,7 +14,7 @@ void ULoadingScreenLib::StartMovie(const FString& MovieNameNoExt, bool bSkippabl
     if (!IsMoviePlayerEnabled())
         return;
 
-    //   +  ( ε   ȭ )
+    // 수동 종료 + 루프 재생(맵 로딩이 끝날 때까지 화면 유지)
     FLoadingScreenAttributes Attr;
     Attr.bAutoCompleteWhenLoadingCompletes = false;
     Attr.bWaitForManualStop = true;    
@@ -58,7 +58,7 @@ void ULoadingScreenLib::PlayTeaserAndOpenLevel(UObject* WorldContextObject,
 {
     StartMovie(MovieNameNoExt, bSkippable, MinDisplayTime);
 
-    // ⼭   ε   εǴ  ȭ  
+    // 여기서부터 실제 월드 로딩 시작 → 로딩되는 동안 영화가 계속 뜸
     UWorld* World = GEngine->GetWorldFromContextObjectChecked(WorldContextObject);
     UGameplayStatics::OpenLevel(World, LevelName, true);
 }
@@ -0,0 +1,152 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "MemoryStain.h"
+#include "Components/StaticMeshComponent.h"
+#include "Net/UnrealNetwork.h"
+#include "NSWorkPoolSubsystem.h"
+
+AMemoryStain::AMemoryStain()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	// 먼 얼룩은 게임 스테이트 업무 현황으로 충분
+	SetNetCullDistanceSquared(FMath::Square(NSNet::WorkCullDistance));
+
+	StainMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("StainMesh"));
+	SetRootComponent(StainMesh);
+
+	// 플레이어 걸레 탐색(WorldDynamic 오버랩)에만 걸리고 이동/시야 트레이스는 막지 않음
+	StainMesh->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	StainMesh->SetCollisionObjectType(ECC_WorldDynamic);
+	StainMesh->SetCollisionResponseToAllChannels(ECR_Overlap);
+	StainMesh->SetCollisionResponseToChannel(ECC_Visibility, ECR_Ignore);
+	StainMesh->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
+	StainMesh->SetGenerateOverlapEvents(true);
+	StainMesh->SetCastShadow(false);
+}
+
+void AMemoryStain::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(AMemoryStain, StainType);
+	DOREPLIFETIME(AMemoryStain, BaseMaterial);
+	DOREPLIFETIME(AMemoryStain, MopProgressQ);
+	DOREPLIFETIME(AMemoryStain, bBeingMopped);
+}
+
+void AMemoryStain::InitializeStain_Implementation(EStainType Type, UMaterialInterface* InBaseMaterial)
+{
+	// 풀 재사용이면 이전 진행 상태 초기화
+	StainType = Type;
+	BaseMaterial = InBaseMaterial;
+	MopElapsedSec = 0.f;
+	MopProgressQ = 0;
+	Moppers = 0;
+	bBeingMopped = false;
+	bCleaned = false;
+
+	OnRep_Appearance();
+	OnRep_MopProgress();
+}
+
+void AMemoryStain::OnReturnedToPool_Implementation()
+{
+	// 걸레질 도중 반납(하루 종료 등)돼도 다음 대여까지 "닦는 중"이 남지 않게. 외형/진행도는 InitializeStain이 덮음
+	Moppers = 0;
+	if (bBeingMopped)
+	{
+		bBeingMopped = false;
+		OnRep_BeingMopped();
+	}
+}
+
+void AMemoryStain::RestoreMopProgress(float Alpha)
+{
+	if (!HasAuthority()) return;
+
+	MopElapsedSec = FMath::Clamp(Alpha, 0.f, 1.f) * MopDurationSec;
+	MopProgressQ = uint8(FMath::FloorToInt(FMath::Clamp(Alpha, 0.f, 1.f) * ProgressSteps));
+	OnRep_MopProgress();
+}
+
+void AMemoryStain::Server_BeginMop_Implementation(AActor* Instigator)
+{
+	if (!HasAuthority() || bCleaned) return;
+
+	++Moppers;
+	if (!bBeingMopped)
+	{
+		bBeingMopped = true;
+		OnRep_BeingMopped();
+	}
+}
+
+void AMemoryStain::Server_EndMop_Implementation()
+{
+	if (!HasAuthority()) return;
+
+	Moppers = FMath::Max(0, Moppers - 1);
+	if (bBeingMopped && Moppers == 0)
+	{
+		bBeingMopped = false;
+		OnRep_BeingMopped();
+	}
+}
+
+bool AMemoryStain::Server_MopAdvance_Implementation(float DeltaSeconds)
+{
+	// 완료는 한 번만 보고 (동시에 닦던 다른 플레이어는 false)
+	if (!HasAuthority() || bCleaned) return false;
+
+	MopElapsedSec += DeltaSeconds;
+	const float Alpha = FMath::Clamp(MopElapsedSec / MopDurationSec, 0.f, 1.f);
+	const uint8 Q = uint8(FMath::FloorToInt(Alpha * ProgressSteps));
+	if (Q != MopProgressQ)
+	{
+		MopProgressQ = Q;
+		OnRep_MopProgress();
+	}
+
+	if (Alpha < 1.f) return false;
+
+	// 완료 알림(디렉터/항목 집계) 후 풀로 반납. 풀 밖 액터면 파괴
+	bCleaned = true;
+	if (UNSWorkPoolSubsystem* Pool = GetWorld()->GetSubsystem<UNSWorkPoolSubsystem>())
+	{
+		Pool->CompleteWork(this);
+	}
+	else
+	{
+		Destroy();
+	}
+	return true;
+}
+
+void AMemoryStain::OnRep_Appearance()
+{
+	if (BaseMaterial)
+	{
+		// 타입별 공유 머티리얼 그대로 (인스턴스별 값은 Custom Primitive Data로만)
+		StainMesh->SetMaterial(0, BaseMaterial);
+	}
+	ApplyFade();
+	if (IsCosmeticNetMode()) BP_OnStainInitialized(StainType);
+}
+
+void AMemoryStain::OnRep_MopProgress()
+{
+	ApplyFade();
+	if (IsCosmeticNetMode()) BP_OnMopProgress(GetMopAlpha());
+}
+
+void AMemoryStain::OnRep_BeingMopped()
+{
+	if (IsCosmeticNetMode()) BP_OnMopStateChanged(bBeingMopped);
+}
+
+void AMemoryStain::ApplyFade()
+{
+	if (!IsCosmeticNetMode()) return;
+	StainMesh->SetCustomPrimitiveDataFloat(FadeDataIndex, 1.f - GetMopAlpha());
+}
@@ -0,0 +1,93 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "MopTarget.h"
+#include "NSPooledActor.h"
+#include "MemoryStain.generated.h"
+
+class UStaticMeshComponent;
+
+/**
+ * 네이티브 기억 얼룩. 걸레질 진행/완료 판정은 전부 C++(IMopTarget 직접 호출)이고,
+ * 페이드는 공유 머티리얼의 Custom Primitive Data로 넘겨 MID/틱 없이 처리한다.
+ * BP 자식(BP_MemoryStain)은 BP_On* 이벤트로 연출만 붙인다. (IMopTarget 함수는 BP에서 오버라이드하지 말 것)
+ */
+UCLASS()
+class AMemoryStain : public AActor, public IMopTarget, public INSPooledActor
+{
+	GENERATED_BODY()
+
+public:
+	AMemoryStain();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// IMopTarget
+	virtual void InitializeStain_Implementation(EStainType Type, UMaterialInterface* BaseMaterial) override;
+	virtual EStainType GetStainType_Implementation() const override { return StainType; }
+	virtual void Server_BeginMop_Implementation(AActor* Instigator) override;
+	virtual void Server_EndMop_Implementation() override;
+	virtual bool Server_MopAdvance_Implementation(float DeltaSeconds) override;
+
+	// INSPooledActor
+	virtual void OnReturnedToPool_Implementation() override;
+
+	// 0(더러움)~1(완료), 양자화된 복제값 기준
+	UFUNCTION(BlueprintPure, Category = "Stain")
+	float GetMopAlpha() const { return float(MopProgressQ) / FMath::Max(1, int32(ProgressSteps)); }
+
+	// 서버: 액터 없는 항목에서 다시 띄울 때 이전 진행도로 (InitializeStain 뒤 호출)
+	void RestoreMopProgress(float Alpha);
+
+protected:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<UStaticMeshComponent> StainMesh;
+
+	// 걸레질 1인 기준 완료까지 걸리는 시간(초). 여럿이 닦으면 그만큼 빨라짐
+	UPROPERTY(EditDefaultsOnly, Category = "Stain", meta = (ClampMin = "0.1"))
+	float MopDurationSec = 2.f;
+
+	// 진행도 복제 단계 수. 단계가 바뀔 때만 복제/페이드 갱신
+	UPROPERTY(EditDefaultsOnly, Category = "Stain", meta = (ClampMin = "1", ClampMax = "255"))
+	uint8 ProgressSteps = 32;
+
+	// 머티리얼에서 읽을 Custom Primitive Data 인덱스 (1=그대로, 0=완전히 지워짐)
+	UPROPERTY(EditDefaultsOnly, Category = "Stain")
+	int32 FadeDataIndex = 0;
+
+	UPROPERTY(ReplicatedUsing = OnRep_Appearance, VisibleInstanceOnly, BlueprintReadOnly, Category = "Stain")
+	EStainType StainType = EStainType::None;
+
+	UPROPERTY(ReplicatedUsing = OnRep_Appearance, VisibleInstanceOnly, Category = "Stain")
+	TObjectPtr<UMaterialInterface> BaseMaterial;
+
+	UPROPERTY(ReplicatedUsing = OnRep_MopProgress, VisibleInstanceOnly, Category = "Stain")
+	uint8 MopProgressQ = 0;
+
+	UPROPERTY(ReplicatedUsing = OnRep_BeingMopped, VisibleInstanceOnly, BlueprintReadOnly, Category = "Stain")
+	bool bBeingMopped = false;
+
+	UFUNCTION() void OnRep_Appearance();
+	UFUNCTION() void OnRep_MopProgress();
+	UFUNCTION() void OnRep_BeingMopped();
+
+	// 연출 전용 훅 (서버/클라 모두 호출, 데디서버 제외)
+	UFUNCTION(BlueprintImplementableEvent, Category = "Stain")
+	void BP_OnStainInitialized(EStainType Type);
+	UFUNCTION(BlueprintImplementableEvent, Category = "Stain")
+	void BP_OnMopProgress(float Alpha);
+	UFUNCTION(BlueprintImplementableEvent, Category = "Stain")
+	void BP_OnMopStateChanged(bool bNewBeingMopped);
+
+private:
+	// 서버 전용 누적 (복제는 MopProgressQ만)
+	float MopElapsedSec = 0.f;
+	int32 Moppers = 0;
+	bool bCleaned = false;
+
+	void ApplyFade();
+	bool IsCosmeticNetMode() const { return GetNetMode() != NM_DedicatedServer; }
+};
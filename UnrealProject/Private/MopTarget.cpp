@@ -5,3 +5,38 @@
 
 
 // Add default functionality here for any IMopTarget functions that are not pure virtual.
+
+bool IMopTarget::IsMopTarget(const UObject* Target)
+{
+	return Target && Target->GetClass()->ImplementsInterface(UMopTarget::StaticClass());
+}
+
+void IMopTarget::InitializeStainOn(UObject* Target, EStainType Type, UMaterialInterface* BaseMaterial)
+{
+	if (IMopTarget* Native = Cast<IMopTarget>(Target)) Native->InitializeStain_Implementation(Type, BaseMaterial);
+	else if (IsMopTarget(Target)) Execute_InitializeStain(Target, Type, BaseMaterial);
+}
+
+EStainType IMopTarget::GetStainTypeOf(const UObject* Target)
+{
+	if (const IMopTarget* Native = Cast<IMopTarget>(Target)) return Native->GetStainType_Implementation();
+	return IsMopTarget(Target) ? Execute_GetStainType(Target) : EStainType::None;
+}
+
+void IMopTarget::BeginMopOn(UObject* Target, AActor* Instigator)
+{
+	if (IMopTarget* Native = Cast<IMopTarget>(Target)) Native->Server_BeginMop_Implementation(Instigator);
+	else if (IsMopTarget(Target)) Execute_Server_BeginMop(Target, Instigator);
+}
+
+void IMopTarget::EndMopOn(UObject* Target)
+{
+	if (IMopTarget* Native = Cast<IMopTarget>(Target)) Native->Server_EndMop_Implementation();
+	else if (IsMopTarget(Target)) Execute_Server_EndMop(Target);
+}
+
+bool IMopTarget::MopAdvanceOn(UObject* Target, float DeltaSeconds)
+{
+	if (IMopTarget* Native = Cast<IMopTarget>(Target)) return Native->Server_MopAdvance_Implementation(DeltaSeconds);
+	return IsMopTarget(Target) && Execute_Server_MopAdvance(Target, DeltaSeconds);
+}
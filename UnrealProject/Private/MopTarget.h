@@ -39,5 +39,20 @@ public:
     // 서버: 진행 델타 적용(완료 시 true 반환)
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable)
     bool Server_MopAdvance(float DeltaSeconds);
+
+    // 네이티브 구현(AMemoryStain)이 오버라이드. BP 구현 클래스는 이 기본값을 쓰지 않음(Execute_가 BP 그래프로 감)
+    virtual void InitializeStain_Implementation(EStainType Type, UMaterialInterface* BaseMaterial) {}
+    virtual EStainType GetStainType_Implementation() const { return EStainType::None; }
+    virtual void Server_BeginMop_Implementation(AActor* Instigator) {}
+    virtual void Server_EndMop_Implementation() {}
+    virtual bool Server_MopAdvance_Implementation(float DeltaSeconds) { return false; }
+
+    // 호출 헬퍼: C++ 구현은 인터페이스 포인터로 직접(VM 없음), BP 구현만 Execute_ 경유. null/미구현이면 무시
+    static bool IsMopTarget(const UObject* Target);
+    static void InitializeStainOn(UObject* Target, EStainType Type, UMaterialInterface* BaseMaterial);
+    static EStainType GetStainTypeOf(const UObject* Target);
+    static void BeginMopOn(UObject* Target, AActor* Instigator);
+    static void EndMopOn(UObject* Target);
+    static bool MopAdvanceOn(UObject* Target, float DeltaSeconds);
 	
 };
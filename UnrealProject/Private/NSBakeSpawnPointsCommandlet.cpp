@@ -0,0 +1,249 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSBakeSpawnPointsCommandlet.h"
+#include "NSSpawnPointAsset.h"
+#include "NSSpawnDirector.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/TargetPoint.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Algo/StableSort.h"
+#include "Misc/PackageName.h"
+#include "Misc/Parse.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#if WITH_EDITOR
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionHelpers.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
+#endif
+
+namespace
+{
+	struct FBakeEntry
+	{
+		FNSBakedSpawnPoint Point;
+		FName Level;
+	};
+
+	bool SavePackageToDisk(UPackage* Package, UObject* Asset)
+	{
+		const FString Ext = Asset && Asset->IsA<UWorld>() ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension();
+		const FString File = FPackageName::LongPackageNameToFilename(Package->GetName(), Ext);
+
+		FSavePackageArgs Args;
+		Args.TopLevelFlags = RF_Public | RF_Standalone;
+		Args.SaveFlags = SAVE_NoError;
+		return UPackage::SavePackage(Package, Asset, *File, Args);
+	}
+
+	// OFPA 액터는 자기 패키지, 아니면 레벨이 든 월드 패키지를 저장
+	UObject* GetSaveTarget(AActor* A)
+	{
+		return A->IsPackageExternal() ? static_cast<UObject*>(A) : static_cast<UObject*>(A->GetLevel()->GetTypedOuter<UWorld>());
+	}
+
+	// 마커 전용 액터만 제거 대상 (다른 컴포넌트를 가진 게임플레이 액터는 남김)
+	bool IsPureMarker(const AActor* A)
+	{
+		return A->GetClass() == AActor::StaticClass() || A->GetClass() == ATargetPoint::StaticClass();
+	}
+}
+
+UNSBakeSpawnPointsCommandlet::UNSBakeSpawnPointsCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UNSBakeSpawnPointsCommandlet::Main(const FString& Params)
+{
+	const TCHAR* Cmd = *Params;
+
+	FString MapPath, AssetPath, Path;
+	if (!FParse::Value(Cmd, TEXT("Map="), MapPath) || !FParse::Value(Cmd, TEXT("Asset="), AssetPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[BAKE] Usage: -run=NSBakeSpawnPoints -Map=/Game/Maps/X -Asset=/Game/Data/DA_XSpawnPoints [-Director=...] [-StripMarkers]"));
+		return 1;
+	}
+	const bool bStripMarkers = FParse::Param(Cmd, TEXT("StripMarkers"));
+
+	// 태그는 디렉터 CDO(BP 지정 시 BP 기본값)에서 읽음
+	UClass* DirectorClass = ANSSpawnDirector::StaticClass();
+	if (FParse::Value(Cmd, TEXT("Director="), Path))
+	{
+		DirectorClass = LoadClass<ANSSpawnDirector>(nullptr, *Path);
+		if (!DirectorClass) { UE_LOG(LogTemp, Error, TEXT("[BAKE] Director class not found: %s"), *Path); return 1; }
+	}
+	const ANSSpawnDirector* Dir = GetDefault<ANSSpawnDirector>(DirectorClass);
+	TArray<FName> Tags;
+	Dir->GetSpawnTags(Tags);
+	if (Tags.Num() > 32)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[BAKE] Too many spawn tags (%d, max 32)"), Tags.Num());
+		return 1;
+	}
+
+	UWorld* World = LoadObject<UWorld>(nullptr, *MapPath);
+	if (!World) { UE_LOG(LogTemp, Error, TEXT("[BAKE] Map not found: %s"), *MapPath); return 1; }
+
+	TArray<FBakeEntry> Entries;
+	TArray<FName> ZoneNames;
+	TMap<UPackage*, UObject*> DirtyPackages;
+	int32 Stripped = 0;
+
+	// 마커면 기록하고, -StripMarkers로 에디터 전용으로 바꿨으면 true
+	// bStreamed: WP 공간 로드 액터. 런타임 셀을 모르므로 StreamedLevelName 구간에 넣고 디렉터가 셀 경계로 배정
+	auto VisitActor = [&](AActor* A, FName LevelName, bool bStreamed) -> bool
+	{
+		if (!IsValid(A) || A->Tags.Num() == 0) return false;
+
+		uint32 TagMask = 0;
+		for (int32 t = 0; t < Tags.Num(); ++t)
+		{
+			if (A->ActorHasTag(Tags[t])) TagMask |= 1u << t;
+		}
+		if (TagMask == 0) return false;
+
+		const FTransform Xform = A->GetActorTransform();
+		FBakeEntry& E = Entries.AddDefaulted_GetRef();
+		E.Level = bStreamed ? UNSSpawnPointAsset::StreamedLevelName : LevelName;
+		E.Point.Location = FVector3f(Xform.GetLocation());
+		E.Point.Rotation = FQuat4f(Xform.GetRotation());
+		E.Point.TagMask = TagMask;
+		E.Point.StainMask = ANSSpawnDirector::GetAllowedStainTypesFromTags(A);
+		E.Point.Zone = uint16(ZoneNames.AddUnique(UNSSpawnPointAsset::GetZoneName(A, LevelName)));
+
+		if (bStripMarkers && !A->bIsEditorOnlyActor)
+		{
+			if (!IsPureMarker(A))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[BAKE] %s is not a plain marker (%s); kept in cook"), *A->GetName(), *A->GetClass()->GetName());
+				return false;
+			}
+			A->Modify();
+			A->bIsEditorOnlyActor = true;
+			++Stripped;
+			return true;
+		}
+		return false;
+	};
+
+	auto VisitLevel = [&](ULevel* Level)
+	{
+		if (!Level) return;
+		const FName LevelName = UNSSpawnPointAsset::GetLevelName(Level);
+		for (AActor* A : Level->Actors)
+		{
+			if (VisitActor(A, LevelName, false)) DirtyPackages.Add(A->GetPackage(), GetSaveTarget(A));
+		}
+	};
+
+	VisitLevel(World->PersistentLevel);
+
+	// 서브레벨: 런타임엔 스트리밍으로 들어오므로 레벨 이름별로 따로 기록
+	for (ULevelStreaming* Streaming : World->GetStreamingLevels())
+	{
+		if (UWorld* Sub = Streaming ? Streaming->GetWorldAsset().LoadSynchronous() : nullptr)
+		{
+			VisitLevel(Sub->PersistentLevel);
+		}
+	}
+
+#if WITH_EDITOR
+	// WP: 액터는 외부 패키지라 월드를 초기화하고 하나씩 로드해서 본다.
+	// 공간 로드 액터는 런타임 셀 레벨로 들어오므로 스트리밍 구간에, 아니면 퍼시스턴트 레벨(항상 로드)로
+	// 콜백이 끝나면 액터가 언로드되므로 제거 표시한 마커는 그 자리에서 저장
+	if (World->IsPartitionedWorld())
+	{
+		World->AddToRoot();
+		UWorld::InitializationValues IVS;
+		IVS.RequiresHitProxies(false).ShouldSimulatePhysics(false).EnableTraceCollision(false)
+			.CreateNavigation(false).CreateAISystem(false).AllowAudioPlayback(false).CreatePhysicsScene(true);
+		World->InitWorld(IVS);
+		World->PersistentLevel->UpdateModelComponents();
+		World->UpdateWorldComponents(true, false);
+
+		const FName LevelName = UNSSpawnPointAsset::GetLevelName(World->PersistentLevel);
+		TSet<AActor*> Seen(World->PersistentLevel->Actors);
+		FWorldPartitionHelpers::ForEachActorWithLoading(World->GetWorldPartition(), AActor::StaticClass(),
+			[&](const FWorldPartitionActorDescInstance* Desc)
+			{
+				AActor* A = Desc->GetActor();
+				if (A && !Seen.Contains(A) && VisitActor(A, LevelName, Desc->GetIsSpatiallyLoaded()))
+				{
+					SavePackageToDisk(A->GetPackage(), GetSaveTarget(A));
+				}
+				return true;
+			});
+	}
+#endif
+
+	if (Entries.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[BAKE] No spawn markers found in %s"), *MapPath);
+	}
+	if (ZoneNames.Num() > MAX_uint16)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[BAKE] Too many zones (%d)"), ZoneNames.Num());
+		return 1;
+	}
+
+	// 레벨 순으로 묶어 구간 기록 (레벨 안에서는 순서 유지 → 포인트 인덱스 안정)
+	Algo::StableSortBy(Entries, [](const FBakeEntry& E) { return E.Level; }, FNameLexicalLess());
+
+	const FString PackageName = FPackageName::ObjectPathToPackageName(AssetPath);
+	UPackage* Package = CreatePackage(*PackageName);
+	Package->FullyLoad();
+	const FName AssetName(FPackageName::GetShortName(PackageName));
+	UNSSpawnPointAsset* Asset = FindObject<UNSSpawnPointAsset>(Package, *AssetName.ToString());
+	if (!Asset)
+	{
+		Asset = NewObject<UNSSpawnPointAsset>(Package, AssetName, RF_Public | RF_Standalone);
+		FAssetRegistryModule::AssetCreated(Asset);
+	}
+
+	Asset->SourceMap = FName(MapPath);
+	Asset->BakedAt = FDateTime::UtcNow();
+	Asset->Tags = Tags;
+	Asset->ZoneNames = MoveTemp(ZoneNames);
+	Asset->Levels.Reset();
+	Asset->Points.Reset(Entries.Num());
+	for (const FBakeEntry& E : Entries)
+	{
+		if (Asset->Levels.Num() == 0 || Asset->Levels.Last().Name != E.Level)
+		{
+			FNSBakedSpawnLevel& L = Asset->Levels.AddDefaulted_GetRef();
+			L.Name = E.Level;
+			L.First = Asset->Points.Num();
+		}
+		Asset->Levels.Last().Num++;
+		Asset->Points.Add(E.Point);
+	}
+	Asset->MarkPackageDirty();
+
+	if (!SavePackageToDisk(Package, Asset))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[BAKE] Failed to save %s"), *PackageName);
+		return 1;
+	}
+
+	int32 SavedMarkers = 0;
+	for (const TPair<UPackage*, UObject*>& KV : DirtyPackages)
+	{
+		SavedMarkers += SavePackageToDisk(KV.Key, KV.Value) ? 1 : 0;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("[BAKE] %s: %d points, %d levels, %d zones (%d bytes) -> %s"),
+		*MapPath, Asset->Points.Num(), Asset->Levels.Num(), Asset->ZoneNames.Num(),
+		int32(Asset->Points.Num() * sizeof(FNSBakedSpawnPoint)), *PackageName);
+	if (bStripMarkers)
+	{
+		UE_LOG(LogTemp, Display, TEXT("[BAKE] Marked %d markers editor-only (%d/%d level packages saved)"), Stripped, SavedMarkers, DirtyPackages.Num());
+	}
+	return 0;
+}
@@ -0,0 +1,26 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "NSBakeSpawnPointsCommandlet.generated.h"
+
+/**
+ * 맵의 스폰 마커(태그 액터)를 UNSSpawnPointAsset 하나로 굽는다. 서브레벨/WP 액터 포함
+ *
+ * UnrealEditor-Cmd.exe UnrealProject -run=NSBakeSpawnPoints -Map=/Game/Maps/Train
+ *   -Asset=/Game/Data/DA_TrainSpawnPoints [-Director=/Game/.../BP_SpawnDirector.BP_SpawnDirector_C] [-StripMarkers]
+ *
+ * -StripMarkers: 구운 마커(TargetPoint/빈 Actor만)를 bIsEditorOnlyActor로 바꿔 저장 → 쿡에서 빠짐. 에디터/PIE에선 그대로 보임
+ */
+UCLASS()
+class UNSBakeSpawnPointsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UNSBakeSpawnPointsCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
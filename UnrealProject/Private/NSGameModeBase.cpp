@@ -75,8 +75,8 @@ void ANSGameModeBase::OnGSDKServerActive()
     AsyncTask(ENamedThreads::GameThread, [this]() {
         UE_LOG(LogTemp, Log, TEXT("[GSDK] Active -> start match"));
         if (auto* GS = GetGameState<ANSGameState>()) {
-            GS->TotalPlayers = GameState.Get() ? GameState.Get()->PlayerArray.Num() : 0;
-            GS->ReadyCount = 0;
+            GS->SetTotalPlayers(GameState.Get() ? GameState.Get()->PlayerArray.Num() : 0);
+            GS->SetReadyCount(0);
             SetPhase(GS, EGamePhase::Waiting);
         }
     });
@@ -192,7 +192,7 @@ void ANSGameModeBase::PostLogin(APlayerController* NewPlayer)
         return;
     }
     if (auto* GS = GetGameState<ANSGameState>()) {
-        GS->TotalPlayers = GameState.Get()->PlayerArray.Num();
+        GS->SetTotalPlayers(GameState.Get()->PlayerArray.Num());
     }
 #if UE_SERVER
     if (NewPlayer && NewPlayer->PlayerState)
@@ -221,13 +221,13 @@ void ANSGameModeBase::Logout(AController* Exiting)
 {
     Super::Logout(Exiting);
     if (auto* GS = GetGameState<ANSGameState>()) {
-        GS->TotalPlayers = GameState.Get()->PlayerArray.Num();
+        GS->SetTotalPlayers(GameState.Get()->PlayerArray.Num());
 
         // 떠난 유저가 Ready였으면 해제
         for (auto It = ReadySet.CreateIterator(); It; ++It) {
             if (It->Get() == Exiting) { It.RemoveCurrent(); break; }
         }
-        GS->ReadyCount = ReadySet.Num();
+        GS->SetReadyCount(ReadySet.Num());
     }
 #if UE_SERVER
     const FString PlayerId = GetPlayerIdForGsdk(Exiting ? Exiting->PlayerState : nullptr);
@@ -274,8 +274,8 @@ void ANSGameModeBase::NotifyPlayerReadyState(APlayerController* Who, bool bReady
         if (GS->bReadyLocked) return;
 
         if (bReady) ReadySet.Add(Who); else ReadySet.Remove(Who);
-        GS->ReadyCount = ReadySet.Num();
-        GS->TotalPlayers = GameState.Get()->PlayerArray.Num();
+        GS->SetReadyCount(ReadySet.Num());
+        GS->SetTotalPlayers(GameState.Get()->PlayerArray.Num());
 
         const bool bAllReady = (GS->TotalPlayers > 0 && GS->ReadyCount == GS->TotalPlayers);
 
@@ -296,56 +296,61 @@ void ANSGameModeBase::NotifyPlayerReadyState(APlayerController* Who, bool bReady
 
 void ANSGameModeBase::SetPhase(ANSGameState* GS, EGamePhase NewPhase) {
     if (!GS) return;
-    GS->Phase = NewPhase;
+    GS->SetPhase(NewPhase);
     UE_LOG(LogTemp, Log, TEXT("[PHASE] -> %d"), (int)NewPhase);
+
+    // 대기/카운트다운 동안 스폰 에셋을 비동기로 올려 둠 (BeginSpawnLoop 전에 상주)
+    if (NewPhase == EGamePhase::Waiting || NewPhase == EGamePhase::Starting)
+    {
+        if (ANSSpawnDirector* Director = FindOrSpawnDirector())
+        {
+            Director->PreloadSpawnAssets();
+        }
+    }
 }
 
 void ANSGameModeBase::StartWorkPhase() {
     if (auto* GS = GetGameState<ANSGameState>()) {
         SetJoinLocked(true);
-        GS->DayScore = 0;
-        GS->TimeLeftSec = 600; // 진행 시간
+        GS->SetDayScore(0);
+        GS->SetWorkDeadline(WorkDurationSec); // 진행 시간 (클라는 마감 시각으로 남은 시간 계산)
         SetPhase(GS, EGamePhase::InProgress);
 
-        GetWorldTimerManager().ClearTimer(WorkTickHandle);
-        GetWorld()->GetTimerManager().SetTimer(WorkTickHandle, this, &ANSGameModeBase::TickWorkTimer, 1.0f, true);
+        GetWorldTimerManager().ClearTimer(WorkTimerHandle);
+        GetWorldTimerManager().SetTimer(WorkTimerHandle, this, &ANSGameModeBase::OnWorkTimeUp, WorkDurationSec, false);
 
 
-        if (!SpawnDirector)
-        {
-            SpawnDirector = Cast<ANSSpawnDirector>(
-                UGameplayStatics::GetActorOfClass(this, ANSSpawnDirector::StaticClass()));
-        }
-        if (!SpawnDirector && SpawnDirectorClass)
-        {
-            FActorSpawnParameters P; P.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-            SpawnDirector = GetWorld()->SpawnActor<ANSSpawnDirector>(SpawnDirectorClass, FTransform::Identity, P);
-        }
+        FindOrSpawnDirector();
 
         if (SpawnDirector)
         {
-            SpawnDirector->BeginSpawnLoop(GS->TimeLeftSec);
-            GS->SpawnStage = ESpawnStage::Early;
+            SpawnDirector->BeginSpawnLoop(WorkDurationSec);
+            GS->SetSpawnStage(ESpawnStage::Early);
             GS->ForceNetUpdate();
         }
     }
 }
 
-void ANSGameModeBase::TickWorkTimer() {
-    if (auto* GS = GetGameState<ANSGameState>()) {
-        GS->TimeLeftSec = FMath::Max(0, GS->TimeLeftSec - 1);
-
-        if (SpawnDirector)
-        {
-            const ESpawnStage S = SpawnDirector->GetStage();
-            if (GS->SpawnStage != S) { GS->SpawnStage = S; GS->ForceNetUpdate(); }
-        }
+ANSSpawnDirector* ANSGameModeBase::FindOrSpawnDirector()
+{
+    if (!SpawnDirector)
+    {
+        SpawnDirector = Cast<ANSSpawnDirector>(
+            UGameplayStatics::GetActorOfClass(this, ANSSpawnDirector::StaticClass()));
+    }
+    if (!SpawnDirector && SpawnDirectorClass)
+    {
+        FActorSpawnParameters P; P.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        SpawnDirector = GetWorld()->SpawnActor<ANSSpawnDirector>(SpawnDirectorClass, FTransform::Identity, P);
+    }
+    return SpawnDirector;
+}
 
-        if (GS->TimeLeftSec <= 0)
-        {
-            GetWorld()->GetTimerManager().ClearTimer(WorkTickHandle);
-            StartEndingPhase();
-        }
+void ANSGameModeBase::OnWorkTimeUp() {
+    // 스테이지 전환은 SpawnDirector가 경계 시각에 직접 GS에 반영
+    if (GetGameState<ANSGameState>())
+    {
+        StartEndingPhase();
     }
 }
 
@@ -354,24 +359,19 @@ void ANSGameModeBase::BeginStartCountdown()
     if (auto* GS = GetGameState<ANSGameState>())
     {
         SetJoinLocked(true);
-        GS->StartCountdownSec = 5;
+        GS->SetStartCountdownDeadline(StartCountdownDurationSec);
         SetPhase(GS, EGamePhase::Starting);
         GetWorld()->GetTimerManager().SetTimer(
-            StartCountdownHandle, this, &ANSGameModeBase::TickStartCountdown, 1.0f, true);
+            StartCountdownHandle, this, &ANSGameModeBase::OnStartCountdownFinished, StartCountdownDurationSec, false);
     }
 }
 
-void ANSGameModeBase::TickStartCountdown()
+void ANSGameModeBase::OnStartCountdownFinished()
 {
     if (auto* GS = GetGameState<ANSGameState>())
     {
-        GS->StartCountdownSec = FMath::Max(0, GS->StartCountdownSec - 1);
-        if (GS->StartCountdownSec <= 0)
-        {
-            GetWorld()->GetTimerManager().ClearTimer(StartCountdownHandle);
-            GS->bReadyLocked = true;                 
-            StartWorkPhase();                        
-        }
+        GS->SetReadyLocked(true);
+        StartWorkPhase();
     }
 }
 
@@ -381,7 +381,7 @@ void ANSGameModeBase::CancelStartCountdown()
     if (auto* GS = GetGameState<ANSGameState>())
     {
         SetJoinLocked(false);
-        GS->StartCountdownSec = 0;
+        GS->SetStartCountdownDeadline(0.f);
         SetPhase(GS, EGamePhase::Waiting);
     }
 }
@@ -391,12 +391,16 @@ void ANSGameModeBase::StartEndingPhase() {
         SetPhase(GS, EGamePhase::Ending);
         if (SpawnDirector) {
             SpawnDirector->EndSpawnLoop();
-            SpawnDirector->DeactivateAllWork();
-            GS->SpawnStage = ESpawnStage::Inactive;
-            GS->ForceNetUpdate();
         }
 
+        // 정리 전에 평가해야 레지스트리에 남은 업무가 패널티에 반영됨
         EvaluateDay();
+
+        if (SpawnDirector) {
+            SpawnDirector->DeactivateAllWork();
+            GS->SetSpawnStage(ESpawnStage::Inactive);
+            GS->ForceNetUpdate();
+        }
         FadeOutThenTeleport();
     }
 }
@@ -407,17 +411,27 @@ void ANSGameModeBase::EvaluateDay()
     if (!GS) return;
 
     // 남은 작업 패널티를 반영하고 싶으면 SpawnDirector에서 값을 얻어와 뺍니다.
-    if (PenaltyPerLeftover > 0 && SpawnDirector)
+    const int32 Left = SpawnDirector ? SpawnDirector->GetAliveWorkCount() : 0;
+    if (SpawnDirector) SpawnDirector->LogLeftoverWork();
+    int32 Score = GS->DayScore;
+    int32 Reputation = GS->Reputation;
+    ApplyDayEvaluation(Score, Reputation, Left, PenaltyPerLeftover);
+    GS->SetDayScore(Score);
+    GS->SetReputation(Reputation);
+
+    // 게임오버/클리어 판정은 텔레포트 직후에 처리
+}
+
+void ANSGameModeBase::ApplyDayEvaluation(int32& InOutDayScore, int32& InOutReputation, int32 Leftover, int32 PenaltyPerLeftover)
+{
+    if (PenaltyPerLeftover > 0)
     {
-        const int32 Left = SpawnDirector->GetAliveWorkCount();
-        GS->DayScore -= Left * PenaltyPerLeftover;
+        InOutDayScore -= Leftover * PenaltyPerLeftover;
     }
 
     // 평판 반영
-    if (GS->DayScore >= 0) { GS->Reputation += 1; }
-    else { GS->Reputation = FMath::Max(0, GS->Reputation - 1); }
-
-    // 게임오버/클리어 판정은 텔레포트 직후에 처리
+    if (InOutDayScore >= 0) { InOutReputation += 1; }
+    else { InOutReputation = FMath::Max(0, InOutReputation - 1); }
 }
 
 void ANSGameModeBase::FadeOutThenTeleport()
@@ -514,7 +528,7 @@ void ANSGameModeBase::ResetForNextDay()
     if (UWorld* W = GetWorld())
     {
         // 안전: 모든 타이머 정리
-        W->GetTimerManager().ClearTimer(WorkTickHandle);
+        W->GetTimerManager().ClearTimer(WorkTimerHandle);
         W->GetTimerManager().ClearTimer(StartCountdownHandle);
     }
 
@@ -535,13 +549,13 @@ void ANSGameModeBase::ResetForNextDay()
     if (GS)
     {
         // 준비 다시 가능하도록 잠금 해제
-        GS->bReadyLocked = false;
+        GS->SetReadyLocked(false);
 
         // 카운트/타이머/스테이지 초기화
-        GS->ReadyCount = 0;
-        GS->TimeLeftSec = 0;
-        GS->StartCountdownSec = 0;
-        GS->SpawnStage = ESpawnStage::Inactive;
+        GS->SetReadyCount(0);
+        GS->SetWorkDeadline(0.f);
+        GS->SetStartCountdownDeadline(0.f);
+        GS->SetSpawnStage(ESpawnStage::Inactive);
 
         // 서버가 들고 있는 준비 집합 초기화(멤버: TSet<APlayerController*> ReadySet)
         ReadySet.Empty();
@@ -571,9 +585,9 @@ void ANSGameModeBase::ResetForNextDay()
 
     if (!bGameOver && !bCleared)
     {
-        GS->Day += 1;                         // 다음 날
-        GS->TimeLeftSec = 0;
-        GS->DayScore = 0;
+        GS->SetDay(GS->Day + 1);              // 다음 날
+        GS->SetWorkDeadline(0.f);
+        GS->SetDayScore(0);
 
         // 준비 상태로 전환 (플레이어들은 여신상에서 다시 "준비"를 누름)
         SetJoinLocked(false);
@@ -606,7 +620,7 @@ void ANSGameModeBase::AddScore_Repair(int32 Count)
 
 void ANSGameModeBase::ForceEvaluateAndNextDay()
 {
-    GetWorldTimerManager().ClearTimer(WorkTickHandle);
+    GetWorldTimerManager().ClearTimer(WorkTimerHandle);
     StartEndingPhase();
 }
 
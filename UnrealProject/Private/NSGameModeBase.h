@@ -49,7 +49,17 @@ public:
 
 	// 진행 상태에 따라 OnDayStarted/OnDayEnded 같은 지점에서 토글
 	void SetJoinLocked(bool bLocked);
+
+	// 하루 평가 규칙: 남은 작업 패널티 → 평판 +1/-1 (월드 없이 호출 가능, 시뮬레이터 공용)
+	static void ApplyDayEvaluation(int32& InOutDayScore, int32& InOutReputation, int32 Leftover, int32 PenaltyPerLeftover);
+
+	static int32 GetMaxDays() { return MaxDays; }
+
+	// 클라 프리패치용: GS->GameModeClass CDO에서 읽음
+	TSubclassOf<ANSSpawnDirector> GetSpawnDirectorClass() const { return SpawnDirectorClass; }
 private:
+	friend class UNSSpawnSimCommandlet;
+
 	UFUNCTION() void OnGSDKServerActive();                 // ALLOCATE 신호 수신
 	UFUNCTION() void OnGSDKShutdown();                     // 종료 콜백
 	UFUNCTION() bool OnGSDKHealthCheck();                  // 헬스체크 콜백
@@ -61,6 +71,7 @@ private:
 	// SpawnDirector 인스턴스 (레벨에 배치했으면 Find해서 씀)
 	UPROPERTY()
 	ANSSpawnDirector* SpawnDirector = nullptr;
+	ANSSpawnDirector* FindOrSpawnDirector();
 
 	// 스폰용 클래스 지정
 	UPROPERTY(EditDefaultsOnly, Category = "Spawn")
@@ -75,6 +86,13 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "Day|Score")
 	int32 PenaltyPerLeftover = 0;
 
+	// 하루 업무 시간 / 전원 준비 후 시작까지(초)
+	UPROPERTY(EditDefaultsOnly, Category = "Day", meta = (ClampMin = "1"))
+	float WorkDurationSec = 600.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Day", meta = (ClampMin = "0.1"))
+	float StartCountdownDurationSec = 5.f;
+
 	static constexpr int32 MaxDays = 7;
 
 #if UE_SERVER
@@ -96,16 +114,16 @@ private:
 	void FadeOutThenTeleport();    // 암전→텔레포트→해제
 	void TeleportAllToStatue();
 
-	// 라운드 타이머
-	FTimerHandle WorkTickHandle;
+	// 라운드 타이머: GS에 마감 시각만 한 번 복제하고 서버는 마감 이벤트 하나만 예약
+	FTimerHandle WorkTimerHandle;
 	void StartWorkPhase();
-	void TickWorkTimer();
+	void OnWorkTimeUp();
 	void StartEndingPhase();
 
 	FTimerHandle StartCountdownHandle;
 
-	void BeginStartCountdown();     // 전원 Ready 시 시작 (5초)
-	void TickStartCountdown();      // 1초마다 감소
+	void BeginStartCountdown();     // 전원 Ready 시 시작
+	void OnStartCountdownFinished();
 	void CancelStartCountdown();    // 누군가 취소하면 중단
 
 	// 내부 헬퍼
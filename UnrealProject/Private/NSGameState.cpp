@@ -4,25 +4,123 @@
 // NSGameState.cpp
 #include "NSGameState.h"
 #include "Net/UnrealNetwork.h"
+#include "NSGameModeBase.h"
+#include "NSSpawnDirector.h"
+#include "NSPlayerController.h"
+#include "EngineUtils.h"
+#include "Engine/AssetManager.h"
+
+ANSGameState::ANSGameState()
+{
+	// 남은 시간은 마감 시각 + PC 시계 동기화로 계산하므로 엔진 기본 서버 시간 복제(0.1초)는 대비용으로만
+	ServerWorldTimeSecondsUpdateFrequency = 10.f;
+}
 
 void ANSGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(ANSGameState, Phase);
-	DOREPLIFETIME(ANSGameState, TimeLeftSec);
-	DOREPLIFETIME(ANSGameState, ReadyCount);
-	DOREPLIFETIME(ANSGameState, TotalPlayers);
-	DOREPLIFETIME(ANSGameState, bReadyLocked);
-	DOREPLIFETIME(ANSGameState, StartCountdownSec);
-	DOREPLIFETIME(ANSGameState, SpawnStage);
-	DOREPLIFETIME(ANSGameState, Day);
-	DOREPLIFETIME(ANSGameState, Reputation);
-	DOREPLIFETIME(ANSGameState, DayScore);
-	DOREPLIFETIME(ANSGameState, MemoryShard);
-}
-
-void ANSGameState::OnRep_Phase() {}
-void ANSGameState::OnRep_TimeLeft() {}
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ANSGameState, Phase, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ANSGameState, WorkEndServerTime, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ANSGameState, ReadyCount, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ANSGameState, TotalPlayers, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ANSGameState, bReadyLocked, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ANSGameState, StartCountdownEndServerTime, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ANSGameState, SpawnStage, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ANSGameState, Day, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ANSGameState, Reputation, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ANSGameState, DayScore, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ANSGameState, MemoryShard, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ANSGameState, WorkStatus, Params);
+}
+
+void ANSGameState::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+	WorkStatus.Owner = this;
+}
+
+void ANSGameState::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+#if NS_VALIDATE_PUSH_MODEL
+	PushValidator.Validate(this, ANSGameState::StaticClass());
+#endif
+}
+
+void ANSGameState::OnRep_Phase()
+{
+	if (Phase == EGamePhase::Starting && !HasAuthority())
+	{
+		PrefetchSpawnAssets();
+	}
+}
+
+void ANSGameState::PrefetchSpawnAssets()
+{
+	if (SpawnAssetPrefetch.IsValid()) return;
+
+	// 레벨에 배치된 디렉터가 있으면 그 설정, 없으면 복제된 GameModeClass의 SpawnDirectorClass 기본값
+	const ANSSpawnDirector* Director = nullptr;
+	for (TActorIterator<ANSSpawnDirector> It(GetWorld()); It; ++It)
+	{
+		Director = *It;
+		break;
+	}
+	if (!Director)
+	{
+		const ANSGameModeBase* GM = GameModeClass ? Cast<ANSGameModeBase>(GameModeClass->GetDefaultObject()) : nullptr;
+		const TSubclassOf<ANSSpawnDirector> DirectorClass = GM ? GM->GetSpawnDirectorClass() : nullptr;
+		Director = DirectorClass ? DirectorClass->GetDefaultObject<ANSSpawnDirector>() : nullptr;
+	}
+	if (!Director) return;
+
+	TArray<FSoftObjectPath> Paths;
+	Director->GatherPreloadPaths(Paths);
+	if (Paths.Num() == 0) return;
+
+	UE_LOG(LogTemp, Log, TEXT("[GS] Prefetch %d spawn assets"), Paths.Num());
+	SpawnAssetPrefetch = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		Paths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+}
+void ANSGameState::OnRep_TimeLeft()
+{
+	UE_LOG(LogTemp, Verbose, TEXT("[GS] WorkEnd = %.2f (left %d)"), WorkEndServerTime, GetTimeLeftSec());
+	OnDeadlineChanged.Broadcast();
+}
+
+void ANSGameState::SetWorkDeadline(float DurationSec)
+{
+	const double EndTime = DurationSec > 0.f ? GetServerWorldTimeSeconds() + DurationSec : 0.0;
+	if (EndTime == WorkEndServerTime) return;
+	NS_SET_DIRTY(ANSGameState, WorkEndServerTime, EndTime);
+	OnRep_TimeLeft();   // 리슨 서버 HUD
+}
+
+void ANSGameState::SetStartCountdownDeadline(float DurationSec)
+{
+	const double EndTime = DurationSec > 0.f ? GetServerWorldTimeSeconds() + DurationSec : 0.0;
+	if (EndTime == StartCountdownEndServerTime) return;
+	NS_SET_DIRTY(ANSGameState, StartCountdownEndServerTime, EndTime);
+	OnRep_StartCountdown();   // 리슨 서버 HUD
+}
+
+int32 ANSGameState::SecondsUntil(double EndServerTime) const
+{
+	if (EndServerTime <= 0.0) return 0;
+	return FMath::Max(0, FMath::CeilToInt(EndServerTime - GetServerWorldTimeSeconds()));
+}
+
+double ANSGameState::GetServerWorldTimeSeconds() const
+{
+	if (!HasAuthority())
+	{
+		const ANSPlayerController* PC = GetWorld() ? GetWorld()->GetFirstPlayerController<ANSPlayerController>() : nullptr;
+		if (PC && PC->HasServerTimeSync()) return PC->GetSyncedServerTime();
+	}
+	return Super::GetServerWorldTimeSeconds();
+}
 void ANSGameState::OnRep_ReadyCount() {}
 void ANSGameState::OnRep_TotalPlayers() {}
 
@@ -35,7 +133,8 @@ void ANSGameState::OnRep_ReadyLock()
 void ANSGameState::OnRep_StartCountdown()
 {
 	// 클라에서 X초 뒤 시작 텍스트 갱신
-	UE_LOG(LogTemp, Verbose, TEXT("[GS] StartCountdown = %d"), StartCountdownSec);
+	UE_LOG(LogTemp, Verbose, TEXT("[GS] StartCountdown = %d"), GetStartCountdownSec());
+	OnDeadlineChanged.Broadcast();
 }
 
 void ANSGameState::OnRep_SpawnStage() { /* HUD 갱신 */ }
@@ -49,7 +148,7 @@ void ANSGameState::AddMemoryShard(int32 Delta)
 	}
 
 	const int32 Old = MemoryShard;
-	MemoryShard = FMath::Max(0, Old + Delta);
+	NS_SET_DIRTY(ANSGameState, MemoryShard, FMath::Max(0, Old + Delta));
 
 	if (MemoryShard != Old)
 	{
@@ -62,4 +161,88 @@ void ANSGameState::OnRep_MemoryShard()
 	OnMemoryShardChanged.Broadcast(MemoryShard);
 }
 
+int32 ANSGameState::GetWorkStatusCount(int32 TypeId) const
+{
+	int32 Count = 0;
+	for (const FNSWorkStatusEntry& E : WorkStatus.Items)
+	{
+		if (E.TypeId == TypeId) ++Count;
+	}
+	return Count;
+}
+
+bool ANSGameState::FindNearestWork(int32 TypeId, FVector From, FVector& OutLocation, float& OutProgress) const
+{
+	const FNSWorkStatusEntry* Best = nullptr;
+	double BestDistSq = TNumericLimits<double>::Max();
+	for (const FNSWorkStatusEntry& E : WorkStatus.Items)
+	{
+		if (E.TypeId != TypeId) continue;
+		const double DistSq = FVector::DistSquared(E.Location, From);
+		if (DistSq < BestDistSq)
+		{
+			BestDistSq = DistSq;
+			Best = &E;
+		}
+	}
+	if (!Best) return false;
 
+	OutLocation = Best->Location;
+	OutProgress = Best->GetProgress();
+	return true;
+}
+
+void ANSGameState::GetWorkLocations(int32 TypeId, TArray<FVector>& OutLocations) const
+{
+	OutLocations.Reset();
+	for (const FNSWorkStatusEntry& E : WorkStatus.Items)
+	{
+		if (E.TypeId == TypeId) OutLocations.Add(E.Location);
+	}
+}
+
+void ANSGameState::AddWorkStatus(uint32 Id, FNSWorkTypeId Type, const FVector& Location)
+{
+	if (!HasAuthority()) return;
+	RemoveWorkStatus(Id);   // 풀 재사용 액터면 이전 항목 교체
+
+	FNSWorkStatusEntry& E = WorkStatus.Items.AddDefaulted_GetRef();
+	E.Id = int32(Id);
+	check(int32(Type) < MaxWorkTypes);
+	E.TypeId = uint8(Type);
+	E.Location = Location;
+	WorkStatus.MarkItemDirty(E);
+	NS_MARK_DIRTY(ANSGameState, WorkStatus);
+	WorkStatusIndex.Add(Id, WorkStatus.Items.Num() - 1);
+	OnWorkStatusChanged.Broadcast();
+}
+
+void ANSGameState::SetWorkStatusProgress(uint32 Id, float Progress)
+{
+	const int32* Index = WorkStatusIndex.Find(Id);
+	if (!Index) return;
+
+	FNSWorkStatusEntry& E = WorkStatus.Items[*Index];
+	const uint8 Q = uint8(FMath::Clamp(FMath::RoundToInt(Progress * 255.f), 0, 255));
+	if (Q == E.ProgressQ) return;
+
+	E.ProgressQ = Q;
+	WorkStatus.MarkItemDirty(E);
+	NS_MARK_DIRTY(ANSGameState, WorkStatus);
+	OnWorkStatusChanged.Broadcast();
+}
+
+void ANSGameState::RemoveWorkStatus(uint32 Id)
+{
+	int32 Index = INDEX_NONE;
+	if (!WorkStatusIndex.RemoveAndCopyValue(Id, Index)) return;
+
+	WorkStatus.Items.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (WorkStatus.Items.IsValidIndex(Index))
+	{
+		WorkStatusIndex[uint32(WorkStatus.Items[Index].Id)] = Index;   // 끝에서 당겨온 항목
+	}
+	WorkStatus.MarkArrayDirty();
+	NS_MARK_DIRTY(ANSGameState, WorkStatus);
+	OnWorkStatusChanged.Broadcast();
+}
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "NSTypes.h"
+#include "NSWorkStatus.h"
+#include "NSPushModel.h"
 #include "GameFramework/GameStateBase.h"
 #include "NSGameState.generated.h"
 
@@ -19,12 +21,15 @@ class ANSGameState : public AGameStateBase
 	GENERATED_BODY()
 	
 public:
+	ANSGameState();
+
+	// 복제 속성은 전부 푸시 모델. 서버는 아래 Set*/Add*로만 바꿈 (직접 대입하면 복제 안 됨)
 	UPROPERTY(ReplicatedUsing = OnRep_Phase, BlueprintReadOnly)
 	EGamePhase Phase = EGamePhase::Waiting;
 
-	// 남은 업무 시간(초) – 클라 HUD 표시용
+	// 업무 마감 시각(서버 월드 시간, 0이면 없음). 페이즈마다 한 번만 복제되고 남은 시간은 클라가 GetTimeLeftSec으로 계산
 	UPROPERTY(ReplicatedUsing = OnRep_TimeLeft, BlueprintReadOnly)
-	int32 TimeLeftSec = 0;
+	double WorkEndServerTime = 0.0;
 
 	// 시작 의식(여신상) 준비 현황
 	UPROPERTY(ReplicatedUsing = OnRep_ReadyCount, BlueprintReadOnly)
@@ -36,8 +41,29 @@ public:
 	UPROPERTY(ReplicatedUsing = OnRep_ReadyLock, BlueprintReadOnly)
 	bool bReadyLocked = false;         // 5초 종료 후 true → 더 이상 토글 불가
 
+	// 시작 카운트다운 마감 시각 (위와 같은 방식)
 	UPROPERTY(ReplicatedUsing = OnRep_StartCountdown, BlueprintReadOnly)
-	int32 StartCountdownSec = 0;
+	double StartCountdownEndServerTime = 0.0;
+
+	// 남은 업무 시간(초, 올림) – 클라 HUD 표시용. 예전 TimeLeftSec/StartCountdownSec 바인딩은 이 함수로 다시 연결
+	UFUNCTION(BlueprintPure, Category = "Time", meta = (DisplayName = "Time Left Sec"))
+	int32 GetTimeLeftSec() const { return SecondsUntil(WorkEndServerTime); }
+
+	UFUNCTION(BlueprintPure, Category = "Time", meta = (DisplayName = "Start Countdown Sec"))
+	int32 GetStartCountdownSec() const { return SecondsUntil(StartCountdownEndServerTime); }
+
+	// 마감 시각이 바뀜 (페이즈 전환 때 1회). 매초 복제가 없어졌으니 위젯은 이걸로 표시 시작/종료
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDeadlineChanged);
+
+	UPROPERTY(BlueprintAssignable, Category = "Time")
+	FOnDeadlineChanged OnDeadlineChanged;
+
+	// 서버: 지금부터 DurationSec 뒤를 마감으로 (0이면 해제)
+	void SetWorkDeadline(float DurationSec);
+	void SetStartCountdownDeadline(float DurationSec);
+
+	// 클라는 로컬 PC가 맞춘 서버 시계(왕복 시간 보정)를 우선 사용
+	virtual double GetServerWorldTimeSeconds() const override;
 
 	UPROPERTY(ReplicatedUsing = OnRep_SpawnStage, BlueprintReadOnly)
 	ESpawnStage SpawnStage = ESpawnStage::Inactive;
@@ -52,7 +78,16 @@ public:
 	int32 DayScore = 0;                 // 오늘 점수 (업무 중 누적)
 
 	UFUNCTION(BlueprintCallable, Category = "Day")
-	void AddScore(int32 Delta) { DayScore += Delta; }
+	void AddScore(int32 Delta) { NS_SET_DIRTY(ANSGameState, DayScore, DayScore + Delta); }
+
+	void SetPhase(EGamePhase NewPhase)           { NS_SET_DIRTY(ANSGameState, Phase, NewPhase); }
+	void SetReadyCount(int32 NewValue)           { NS_SET_DIRTY(ANSGameState, ReadyCount, NewValue); }
+	void SetTotalPlayers(int32 NewValue)         { NS_SET_DIRTY(ANSGameState, TotalPlayers, NewValue); }
+	void SetReadyLocked(bool bNewValue)          { NS_SET_DIRTY(ANSGameState, bReadyLocked, bNewValue); }
+	void SetSpawnStage(ESpawnStage NewStage)     { NS_SET_DIRTY(ANSGameState, SpawnStage, NewStage); }
+	void SetDay(int32 NewValue)                  { NS_SET_DIRTY(ANSGameState, Day, NewValue); }
+	void SetReputation(int32 NewValue)           { NS_SET_DIRTY(ANSGameState, Reputation, NewValue); }
+	void SetDayScore(int32 NewValue)             { NS_SET_DIRTY(ANSGameState, DayScore, NewValue); }
 
 	UPROPERTY(ReplicatedUsing = OnRep_MemoryShard, BlueprintReadOnly, Category = "Shard")
 	int32 MemoryShard = 0;
@@ -70,6 +105,31 @@ public:
 
 	UFUNCTION() void OnRep_MemoryShard();
 
+	// 살아 있는 업무 현황 (디렉터가 갱신). 클라 HUD/미니맵은 액터를 찾지 않고 이것만 읽음
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnWorkStatusChanged);
+
+	UPROPERTY(BlueprintAssignable, Category = "Work")
+	FOnWorkStatusChanged OnWorkStatusChanged;
+
+	const TArray<FNSWorkStatusEntry>& GetWorkStatus() const { return WorkStatus.Items; }
+
+	// TypeId = 디렉터 WorkTypes 목록 인덱스 (기본 4종은 EWorkType 값). 정의 에셋으로 추가한 타입도 조회 가능
+	UFUNCTION(BlueprintPure, Category = "Work")
+	int32 GetWorkStatusCount(int32 TypeId) const;
+
+	// From에서 가장 가까운 TypeId 업무. 없으면 false
+	UFUNCTION(BlueprintCallable, Category = "Work")
+	bool FindNearestWork(int32 TypeId, FVector From, FVector& OutLocation, float& OutProgress) const;
+
+	// 미니맵용: TypeId 업무 위치 전부
+	UFUNCTION(BlueprintCallable, Category = "Work")
+	void GetWorkLocations(int32 TypeId, TArray<FVector>& OutLocations) const;
+
+	// 서버 전용
+	void AddWorkStatus(uint32 Id, FNSWorkTypeId Type, const FVector& Location);
+	void SetWorkStatusProgress(uint32 Id, float Progress);   // 양자화 값이 바뀔 때만 더티
+	void RemoveWorkStatus(uint32 Id);
+
 	UFUNCTION() void OnRep_SpawnStage();
 	
 	UFUNCTION() void OnRep_Phase();
@@ -83,5 +143,25 @@ public:
 	UFUNCTION() void OnRep_StartCountdown();
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
-	
+	virtual void PostInitializeComponents() override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
+protected:
+	UPROPERTY(Replicated)
+	FNSWorkStatusArray WorkStatus;
+
+private:
+	int32 SecondsUntil(double EndServerTime) const;
+
+	// 서버: Id → WorkStatus.Items 인덱스
+	TMap<uint32, int32> WorkStatusIndex;
+
+#if NS_VALIDATE_PUSH_MODEL
+	FNSPushModelValidator PushValidator;
+	friend class FNSPushModelTest;   // Tests/NSPushModelTest.cpp
+#endif
+
+	// 클라: Starting 진입 시 스폰 에셋 프리패치 (첫 스폰 복제 때 로드 히치 방지)
+	void PrefetchSpawnAssets();
+	TSharedPtr<struct FStreamableHandle> SpawnAssetPrefetch;
 };
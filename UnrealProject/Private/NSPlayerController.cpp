@@ -4,6 +4,7 @@
 #include "NSPlayerController.h"
 #include "Kismet/GameplayStatics.h"
 #include "NSGameModeBase.h"
+#include "PlayerCharacter.h"
 
 #include "EnhancedInputSubsystems.h"
 #include "InputMappingContext.h" 
@@ -20,6 +21,12 @@ void ANSPlayerController::BeginPlay()
     Super::BeginPlay();
     if (!IsLocalController()) return;
 
+    // 접속 직후 몇 번 촘촘히 재서 오프셋을 잡고, 이후엔 드물게 보정
+    if (GetNetMode() == NM_Client)
+    {
+        GetWorldTimerManager().SetTimer(TimeSyncHandle, this, &ANSPlayerController::RequestServerTimeSync, 0.5f, true, 0.f);
+    }
+
     // 맵 이름으로 자동 재생(원하면 BP에서 명시 호출)
     const FString MapName = GetWorld()->GetMapName();
     if (MapName.Contains(TEXT("Title")))
@@ -175,6 +182,43 @@ void ANSPlayerController::Client_HideStartupLoading_Implementation()
     RefreshInputForCurrentUI();
 }
 
+void ANSPlayerController::Client_PlayCosmetic_Implementation(APlayerCharacter* Source, ECharacterCosmetic Event, AActor* Target, EStainType StainType)
+{
+    if (IsValid(Source))
+    {
+        Source->PlayCosmetic(Event, Target, StainType);
+    }
+}
+
+void ANSPlayerController::RequestServerTimeSync()
+{
+    Server_RequestServerTime(GetWorld()->GetTimeSeconds());
+}
+
+void ANSPlayerController::Server_RequestServerTime_Implementation(double ClientSendTime)
+{
+    Client_ReportServerTime(ClientSendTime, GetWorld()->GetTimeSeconds());
+}
+
+void ANSPlayerController::Client_ReportServerTime_Implementation(double ClientSendTime, double ServerTime)
+{
+    const double Now = GetWorld()->GetTimeSeconds();
+    const double Rtt = FMath::Max(0.0, Now - ClientSendTime);
+
+    // 왕복이 짧을수록 편도 추정(Rtt/2)이 정확. 최선의 1.5배 이내면 받아 들여 클라 히치로 밀린 시계도 따라감
+    if (!bServerTimeSynced || Rtt <= BestTimeSyncRtt * 1.5)
+    {
+        ServerTimeOffset = ServerTime + Rtt * 0.5 - Now;
+        BestTimeSyncRtt = FMath::Min(BestTimeSyncRtt, Rtt);
+        bServerTimeSynced = true;
+    }
+
+    if (++TimeSyncSamples == 5)
+    {
+        GetWorldTimerManager().SetTimer(TimeSyncHandle, this, &ANSPlayerController::RequestServerTimeSync, 10.f, true);
+    }
+}
+
 void ANSPlayerController::Server_ReportStartupLoaded_Implementation()
 {
     // 서버에서 이 컨트롤러 스폰 진행 (GameMode에 위임)
@@ -6,9 +6,11 @@
 #include "GameFramework/PlayerController.h"
 #include "Sound/SoundBase.h"
 #include "Components/AudioComponent.h"
+#include "NSTypes.h"
 #include "NSPlayerController.generated.h"
 
 class UInputMappingContext;
+class APlayerCharacter;
 
 /**
  * 
@@ -60,6 +62,17 @@ public:
 
     UFUNCTION(Server, Reliable) void Server_ReportStartupLoaded();
 
+    // 서버 시계 동기화: 왕복 시간이 짧은 샘플 기준 오프셋. GS 마감 시각 → 남은 시간 계산에 사용
+    bool HasServerTimeSync() const { return bServerTimeSynced; }
+    double GetSyncedServerTime() const { return GetWorld()->GetTimeSeconds() + ServerTimeOffset; }
+
+    UFUNCTION(Server, Unreliable) void Server_RequestServerTime(double ClientSendTime);
+    UFUNCTION(Client, Unreliable) void Client_ReportServerTime(double ClientSendTime, double ServerTime);
+
+    // 범위 제한 코스메틱 (APlayerCharacter::SendCosmetic). Source가 이 클라에 복제 안 됐으면 무시
+    UFUNCTION(Client, Unreliable)
+    void Client_PlayCosmetic(APlayerCharacter* Source, ECharacterCosmetic Event, AActor* Target, EStainType StainType);
+
     UPROPERTY(EditDefaultsOnly, Category = "UI")
     TSubclassOf<UUserWidget> PauseMenuClass;
 
@@ -90,4 +103,11 @@ private:
     bool bOnboardingActive = false;
 
     void RefreshInputForCurrentUI();
+
+    void RequestServerTimeSync();
+    FTimerHandle TimeSyncHandle;
+    double ServerTimeOffset = 0.0;
+    double BestTimeSyncRtt = TNumericLimits<double>::Max();
+    int32 TimeSyncSamples = 0;
+    bool bServerTimeSynced = false;
 };
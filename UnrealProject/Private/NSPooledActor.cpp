@@ -0,0 +1,15 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSPooledActor.h"
+#include "GameFramework/Actor.h"
+
+void INSPooledActor::NotifyAcquired(AActor* Actor)
+{
+	if (Actor && Actor->Implements<UNSPooledActor>()) Execute_OnAcquiredFromPool(Actor);
+}
+
+void INSPooledActor::NotifyReturned(AActor* Actor)
+{
+	if (Actor && Actor->Implements<UNSPooledActor>()) Execute_OnReturnedToPool(Actor);
+}
@@ -0,0 +1,40 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+
+#include "NSPooledActor.generated.h"
+
+// This class does not need to be modified.
+UINTERFACE(MinimalAPI)
+class UNSPooledActor : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * 작업 풀(UNSWorkPoolSubsystem)로 재사용되는 업무 액터의 초기화 훅. (서버 전용)
+ * 풀은 위치/표시/충돌/틱만 복구하므로 흡입/수집/탑승 같은 게임플레이 상태는 각 클래스가 여기서 정리한다.
+ * BP 클래스(샤드/승객)도 구현할 수 있게 BlueprintNativeEvent.
+ */
+class INSPooledActor
+{
+	GENERATED_BODY()
+
+public:
+    // 풀에서 꺼내 활성화한 직후 (스폰 위치 적용 후, 호출자의 타입별 초기화 전)
+    UFUNCTION(BlueprintNativeEvent, Category = "Pool")
+    void OnAcquiredFromPool();
+    virtual void OnAcquiredFromPool_Implementation() {}
+
+    // 숨김/비활성화 직후 (사전 생성 때도 1회)
+    UFUNCTION(BlueprintNativeEvent, Category = "Pool")
+    void OnReturnedToPool();
+    virtual void OnReturnedToPool_Implementation() {}
+
+    // 호출 헬퍼: 미구현 액터는 무시 (BP 오버라이드가 있으므로 항상 Execute_ 경유)
+    static void NotifyAcquired(AActor* Actor);
+    static void NotifyReturned(AActor* Actor);
+};
@@ -9,11 +9,13 @@
 #include "GameFramework/PlayerController.h"
 #include "TimerManager.h"
 #include "EngineUtils.h"
+#include "NSTypes.h"
 
 ANSPortal::ANSPortal()
 {
     PrimaryActorTick.bCanEverTick = false;
     bReplicates = true;
+    SetNetCullDistanceSquared(FMath::Square(NSNet::PortalCullDistance));
 
     Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
     SetRootComponent(Root);
@@ -0,0 +1,50 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSPushModel.h"
+
+#if NS_VALIDATE_PUSH_MODEL
+#include "HAL/IConsoleManager.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+	int32 GValidatePushModel = 1;
+	FAutoConsoleVariableRef CVarValidatePushModel(
+		TEXT("net.NS.ValidatePushModel"), GValidatePushModel,
+		TEXT("1: report push-model properties that changed without being marked dirty (non-shipping only)"));
+}
+
+int32 FNSPushModelValidator::Validate(const UObject* Owner, const UClass* Scope)
+{
+	if (!GValidatePushModel || !Owner || !Scope) return 0;
+
+	int32 NumReports = 0;
+	for (TFieldIterator<FProperty> It(Scope, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		const FProperty* Prop = *It;
+		if (!Prop->HasAnyPropertyFlags(CPF_Net)) continue;
+		if (const FStructProperty* StructProp = CastField<FStructProperty>(Prop))
+		{
+			if (StructProp->Struct->StructFlags & STRUCT_NetDeltaSerializeNative) continue;
+		}
+
+		FString Value;
+		Prop->ExportTextItem_InContainer(Value, Owner, nullptr, nullptr, PPF_None);
+
+		FString& Prev = Snapshot.FindOrAdd(Prop->GetFName());
+		if (bHasSnapshot && Prev != Value && !Dirty.Contains(Prop->GetFName()))
+		{
+			UE_LOG(LogTemp, Error, TEXT("[NET] %s.%s changed (%s -> %s) without NS_MARK_DIRTY"),
+				*Owner->GetName(), *Prop->GetName(), *Prev, *Value);
+			ensureMsgf(false, TEXT("Push-model property %s::%s changed without being marked dirty"),
+				*Scope->GetName(), *Prop->GetName());
+			++NumReports;
+		}
+		Prev = MoveTemp(Value);
+	}
+	bHasSnapshot = true;
+	Dirty.Reset();
+	return NumReports;
+}
+#endif
@@ -0,0 +1,44 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+// 비출시 빌드: 값이 바뀌었는데 dirty 표시가 빠진 푸시 모델 속성을 PreReplication에서 잡아냄
+#define NS_VALIDATE_PUSH_MODEL (!UE_BUILD_SHIPPING)
+
+#if NS_VALIDATE_PUSH_MODEL
+#define NS_NOTE_PUSH_DIRTY(Class, Prop) PushValidator.NoteDirty(GET_MEMBER_NAME_CHECKED(Class, Prop))
+#else
+#define NS_NOTE_PUSH_DIRTY(Class, Prop)
+#endif
+
+// 푸시 모델 속성은 반드시 이 매크로로 dirty 표시 (검증기에도 기록됨)
+#define NS_MARK_DIRTY(Class, Prop) \
+	do { MARK_PROPERTY_DIRTY_FROM_NAME(Class, Prop, this); NS_NOTE_PUSH_DIRTY(Class, Prop); } while (0)
+
+// 값이 다를 때만 대입 + dirty
+#define NS_SET_DIRTY(Class, Prop, NewValue) \
+	do { if (Prop != (NewValue)) { Prop = (NewValue); NS_MARK_DIRTY(Class, Prop); } } while (0)
+
+#if NS_VALIDATE_PUSH_MODEL
+/**
+ * 푸시 모델 누락 검출기. 소유 클래스가 선언한 복제 속성 값을 PreReplication마다 이전 스냅샷과 비교해
+ * 바뀌었는데 NS_MARK_DIRTY가 없었던 속성을 에러 로그 + ensure로 보고 (net.NS.ValidatePushModel=0으로 끔)
+ * FastArray 같은 델타 직렬화 구조체는 자체 더티 추적이라 제외
+ */
+struct FNSPushModelValidator
+{
+	void NoteDirty(FName Property) { Dirty.Add(Property); }
+
+	// Scope = 검사할 속성을 선언한 클래스 (부모 클래스 속성 제외). 첫 호출은 스냅샷만
+	// 반환: 이번 호출에서 보고한 누락 수 (자동화 테스트용)
+	int32 Validate(const UObject* Owner, const UClass* Scope);
+
+private:
+	TMap<FName, FString> Snapshot;
+	TSet<FName> Dirty;
+	bool bHasSnapshot = false;
+};
+#endif
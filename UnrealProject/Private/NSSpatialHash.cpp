@@ -0,0 +1,104 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSSpatialHash.h"
+
+void FNSSpatialHash::Init(float InCellSize)
+{
+	CellSize = FMath::Max(1.f, InCellSize);
+	Reset();
+}
+
+void FNSSpatialHash::Reset()
+{
+	Cells.Reset();
+	Where.Reset();
+}
+
+FIntVector FNSSpatialHash::CellOf(const FVector& P) const
+{
+	return FIntVector(
+		FMath::FloorToInt(P.X / CellSize),
+		FMath::FloorToInt(P.Y / CellSize),
+		FMath::FloorToInt(P.Z / CellSize));
+}
+
+void FNSSpatialHash::Add(uint32 Id, const FVector& Pos, FNSWorkTypeId Type, float ExpireAt)
+{
+	Remove(Id);
+
+	const FIntVector Cell = CellOf(Pos);
+	FEntry& E = Cells.FindOrAdd(Cell).AddDefaulted_GetRef();
+	E.Id = Id;
+	E.Pos = Pos;
+	E.Type = Type;
+	E.ExpireAt = ExpireAt;
+	Where.Add(Id, Cell);
+}
+
+bool FNSSpatialHash::Remove(uint32 Id)
+{
+	FIntVector Cell;
+	if (!Where.RemoveAndCopyValue(Id, Cell)) return false;
+
+	if (auto* Bucket = Cells.Find(Cell))
+	{
+		Bucket->RemoveAllSwap([Id](const FEntry& E) { return E.Id == Id; }, EAllowShrinking::No);
+		if (Bucket->Num() == 0) Cells.Remove(Cell);
+	}
+	return true;
+}
+
+void FNSSpatialHash::RemoveType(FNSWorkTypeId Type)
+{
+	for (auto It = Cells.CreateIterator(); It; ++It)
+	{
+		It.Value().RemoveAllSwap([this, Type](const FEntry& E)
+			{
+				if (E.Type != Type) return false;
+				Where.Remove(E.Id);
+				return true;
+			}, EAllowShrinking::No);
+		if (It.Value().Num() == 0) It.RemoveCurrent();
+	}
+}
+
+int32 FNSSpatialHash::RemoveExpired(float Now)
+{
+	int32 Removed = 0;
+	for (auto It = Cells.CreateIterator(); It; ++It)
+	{
+		Removed += It.Value().RemoveAllSwap([this, Now](const FEntry& E)
+			{
+				if (E.ExpireAt > Now) return false;
+				Where.Remove(E.Id);
+				return true;
+			}, EAllowShrinking::No);
+		if (It.Value().Num() == 0) It.RemoveCurrent();
+	}
+	return Removed;
+}
+
+bool FNSSpatialHash::AnyWithin(const FVector& Pos, float Radius, uint32 TypeMask, float Now) const
+{
+	if (Radius <= 0.f || Cells.Num() == 0) return false;
+
+	const float RadiusSq = Radius * Radius;
+	const FIntVector Lo = CellOf(Pos - FVector(Radius));
+	const FIntVector Hi = CellOf(Pos + FVector(Radius));
+
+	for (int32 X = Lo.X; X <= Hi.X; ++X)
+	for (int32 Y = Lo.Y; Y <= Hi.Y; ++Y)
+	for (int32 Z = Lo.Z; Z <= Hi.Z; ++Z)
+	{
+		const auto* Bucket = Cells.Find(FIntVector(X, Y, Z));
+		if (!Bucket) continue;
+
+		for (const FEntry& E : *Bucket)
+		{
+			if (!(TypeMask & WorkTypeBit(E.Type)) || E.ExpireAt <= Now) continue;
+			if (FVector::DistSquared(E.Pos, Pos) <= RadiusSq) return true;
+		}
+	}
+	return false;
+}
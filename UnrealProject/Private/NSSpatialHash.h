@@ -0,0 +1,47 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NSTypes.h"
+
+static constexpr uint32 WorkTypeBit(FNSWorkTypeId T) { return 1u << uint32(T); }
+static constexpr uint32 AllWorkTypeBits = MAX_uint32;
+static_assert(MaxWorkTypes <= 32, "WorkTypeBit mask is uint32");
+
+/**
+ * 균일 격자 공간 해시. 살아 있는 업무 액터 위치를 셀 단위로 들고 반경 질의만 한다 (물리 쿼리 없음)
+ * 셀 크기는 가장 자주 쓰는 질의 반경 이상으로 두면 질의당 최대 27셀.
+ */
+struct FNSSpatialHash
+{
+	struct FEntry
+	{
+		uint32 Id = 0;
+		FVector Pos = FVector::ZeroVector;
+		FNSWorkTypeId Type = WorkTypeId(EWorkType::Stain);
+		float ExpireAt = MAX_flt;   // 승객처럼 스폰 자리를 떠나는 타입은 만료 시각
+	};
+
+	void Init(float InCellSize);
+	void Reset();
+
+	// 같은 Id가 있으면 옮겨 넣음 (풀 재사용 액터)
+	void Add(uint32 Id, const FVector& Pos, FNSWorkTypeId Type, float ExpireAt = MAX_flt);
+	bool Remove(uint32 Id);
+	void RemoveType(FNSWorkTypeId Type);
+	// 만료 시각이 지난 항목 제거 (승객 점유가 쌓이지 않게). 제거 수 반환
+	int32 RemoveExpired(float Now);
+
+	// Pos에서 Radius 안에 TypeMask 타입 항목이 있으면 true (Now 기준 만료된 항목은 무시)
+	bool AnyWithin(const FVector& Pos, float Radius, uint32 TypeMask, float Now) const;
+
+	int32 Num() const { return Where.Num(); }
+
+private:
+	float CellSize = 200.f;
+	TMap<FIntVector, TArray<FEntry, TInlineAllocator<2>>> Cells;
+	TMap<uint32, FIntVector> Where;
+
+	FIntVector CellOf(const FVector& P) const;
+};
@@ -8,267 +8,1439 @@
 #include "Engine/TargetPoint.h"
 #include "InteractiveActor.h"
 #include "MopTarget.h"
+#include "MemoryStain.h"
+#include "NSWorkPoolSubsystem.h"
+#include "NSGameState.h"
+#include "NSSpawnPointAsset.h"
+#include "NSWorkTypeDef.h"
+#include "NSWorkItemSubsystem.h"
+#include "Engine/AssetManager.h"
+#include "Engine/NetDriver.h"
+#include "Misc/App.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "WorldPartition/WorldPartitionRuntimeCell.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "CollisionQueryParams.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Async/ParallelFor.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Algo/SortBy.h"
+#include "Misc/Paths.h"
+#if UE_SERVER
+#include "GSDKUtils.h"
+#endif
 
 static const FName TAG_WALL = TEXT("Stain_Wall");
 static const FName TAG_FLOOR = TEXT("Stain_Floor");
 static const FName TAG_OBJECT = TEXT("Stain_Object");
 
+static constexpr uint8 StainBit(EStainType T) { return uint8(1u << uint8(T)); }
+
+// stat NSSpawn
+DECLARE_STATS_GROUP(TEXT("NSSpawn"), STATGROUP_NSSpawn, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Spawn Queue Drain"), STAT_NSSpawnDrain, STATGROUP_NSSpawn);
+DECLARE_CYCLE_STAT(TEXT("Spawn Event"), STAT_NSSpawnEvent, STATGROUP_NSSpawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawn Queue Depth"), STAT_NSSpawnQueueDepth, STATGROUP_NSSpawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawns This Frame"), STAT_NSSpawnsThisFrame, STATGROUP_NSSpawn);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Spawn Drain ms"), STAT_NSSpawnDrainMs, STATGROUP_NSSpawn);
+DECLARE_CYCLE_STAT(TEXT("Spawn Point Scoring"), STAT_NSSpawnScore, STATGROUP_NSSpawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawn LOS Traces"), STAT_NSSpawnLosTraces, STATGROUP_NSSpawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawn LOS Pending"), STAT_NSSpawnLosPending, STATGROUP_NSSpawn);
+
+void FSpawnPointSet::Add(const FTransform& Xform, uint8 StainMask, int32 Zone)
+{
+	const FVector P = Xform.GetLocation();
+	Transforms.Add(Xform);
+	StainMasks.Add(StainMask);
+	X.Add(float(P.X)); Y.Add(float(P.Y)); Z.Add(float(P.Z));
+	Zones.Add(Zone);
+}
+
+void FSpawnPointSet::Append(const FSpawnPointSet& Other)
+{
+	Transforms.Append(Other.Transforms);
+	StainMasks.Append(Other.StainMasks);
+	X.Append(Other.X); Y.Append(Other.Y); Z.Append(Other.Z);
+	Zones.Append(Other.Zones);
+}
+
+void FSpawnPointSet::SortByLocation()
+{
+	TArray<int32> Order;
+	Order.SetNumUninitialized(Num());
+	for (int32 i = 0; i < Order.Num(); ++i) Order[i] = i;
+	Algo::Sort(Order, [this](int32 A, int32 B)
+		{
+			if (X[A] != X[B]) return X[A] < X[B];
+			if (Y[A] != Y[B]) return Y[A] < Y[B];
+			if (Z[A] != Z[B]) return Z[A] < Z[B];
+			return StainMasks[A] < StainMasks[B];
+		});
+
+	FSpawnPointSet Sorted;
+	for (const int32 i : Order) Sorted.Add(Transforms[i], StainMasks[i], Zones[i]);
+	*this = MoveTemp(Sorted);
+}
+
 ANSSpawnDirector::ANSSpawnDirector()
 {
+	// 스폰은 스케줄 타이머로만 진행. Tick은 스폰 큐가 남아 있을 때만 켠다
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 	SetReplicates(false);
 }
 
-void ANSSpawnDirector::BeginPlay()
+void ANSSpawnDirector::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (HasAuthority())
+	{
+		ResolveWorkTypes();
+
+		// 스트리밍(WP 셀/서브레벨)으로 포인트가 들어오거나 나가면 테이블 무효화
+		LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &ANSSpawnDirector::OnLevelAdded);
+		LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &ANSSpawnDirector::OnLevelRemoved);
+
+		if (UNSWorkItemSubsystem* Items = GetWorkItems())
+		{
+			ItemResolvedHandle = Items->OnItemResolved.AddUObject(this, &ANSSpawnDirector::HandleWorkItemResolved);
+		}
+		if (UNSWorkPoolSubsystem* Pool = GetWorkPool())
+		{
+			WorkCompletedHandle = Pool->OnWorkCompleted.AddUObject(this, &ANSSpawnDirector::HandleWorkDestroyed);
+		}
+
+		// 에셋 프리로드(+풀 프리웜)는 게임모드가 Waiting/Starting 페이즈 진입 때 요청
+	}
+}
+
+void ANSSpawnDirector::GatherPreloadPaths(TArray<FSoftObjectPath>& Out) const
+{
+	auto AddPath = [&Out](const FSoftObjectPath& Path) { if (!Path.IsNull()) Out.AddUnique(Path); };
+
+	AddPath(StainClass.ToSoftObjectPath());
+	if (WorkTypes.Num() > 0)
+	{
+		for (const UNSWorkTypeDef* Def : WorkTypes)
+		{
+			if (!Def) continue;
+			AddPath(Def->ActorClass.ToSoftObjectPath());
+			if (Def->bActorless)
+			{
+				AddPath(Def->ProxyMesh.ToSoftObjectPath());
+				AddPath(Def->ProxyMaterial.ToSoftObjectPath());
+			}
+		}
+	}
+	else
+	{
+		AddPath(MemoryStainClass.ToSoftObjectPath());
+		AddPath(MemoryShardClass.ToSoftObjectPath());
+		AddPath(PassengerClass.ToSoftObjectPath());
+	}
+	AddPath(SpawnPointAsset.ToSoftObjectPath());
+	for (const auto& KV : StainBaseMaterials) AddPath(KV.Value.ToSoftObjectPath());
+	for (const auto& KV : StainMaterials)     AddPath(KV.Value.ToSoftObjectPath());
+}
+
+void ANSSpawnDirector::PreloadSpawnAssets()
+{
+	// 이미 요청(진행 중/완료)했으면 무시
+	if (bSpawnAssetsReady || PreloadHandle.IsValid()) return;
+
+	TArray<FSoftObjectPath> Paths;
+	GatherPreloadPaths(Paths);
+	if (Paths.Num() == 0)
+	{
+		OnSpawnAssetsLoaded();
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[SPAWN] Preload %d spawn assets"), Paths.Num());
+	PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		Paths, FStreamableDelegate::CreateUObject(this, &ANSSpawnDirector::OnSpawnAssetsLoaded),
+		FStreamableManager::AsyncLoadHighPriority);
+}
+
+void ANSSpawnDirector::OnSpawnAssetsLoaded()
+{
+	if (bSpawnAssetsReady) return;
+	bSpawnAssetsReady = true;
+
+	UE_LOG(LogTemp, Log, TEXT("[SPAWN] Spawn assets resident"));
+	if (HasAuthority())
+	{
+		PrewarmWorkPool();
+	}
+}
+
+UNSWorkPoolSubsystem* ANSSpawnDirector::GetWorkPool() const
+{
+	return GetWorld()->GetSubsystem<UNSWorkPoolSubsystem>();
+}
+
+UNSWorkItemSubsystem* ANSSpawnDirector::GetWorkItems() const
+{
+	return GetWorld()->GetSubsystem<UNSWorkItemSubsystem>();
+}
+
+void ANSSpawnDirector::PrewarmWorkPool()
+{
+	if (UNSWorkPoolSubsystem* Pool = GetWorkPool())
+	{
+		for (const UNSWorkTypeDef* Def : ActiveWorkTypes)
+		{
+			if (Def->PrewarmCount > 0) Pool->Prewarm(Def->ActorClass.Get(), Def->PrewarmCount, this);
+		}
+	}
+}
+
+void ANSSpawnDirector::MakeWorkTypes(TArray<TObjectPtr<UNSWorkTypeDef>>& Out) const
+{
+	Out.Reset();
+	if (WorkTypes.Num() > 0)
+	{
+		for (UNSWorkTypeDef* Def : WorkTypes)
+		{
+			if (Def) Out.Add(Def);
+		}
+		return;
+	}
+
+	// 예전 필드 → 기본 4종. 추가 순서가 곧 타입 ID라 EWorkType 값과 일치
+	auto Make = [&](FNSWorkTypeId Type, const TCHAR* Name, EWorkSpawnMode Mode, FName Tag, const TSoftClassPtr<AActor>& Cls,
+		int32 FStageQuota::* Quota, float Cooldown, int32 Prewarm, float SimClearSec) -> UNSWorkTypeDef*
+	{
+		check(Out.Num() == int32(Type));
+		UNSWorkTypeDef* Def = NewObject<UNSWorkTypeDef>(GetTransientPackage());
+		Def->TypeName = Name;
+		Def->SpawnMode = Mode;
+		Def->SpawnTag = Tag;
+		Def->ActorClass = Cls;
+		Def->EarlyQuota = EarlyQuota.*Quota;
+		Def->PeakQuota = PeakQuota.*Quota;
+		Def->CleanupQuota = CleanupQuota.*Quota;
+		Def->CooldownSec = Cooldown;
+		Def->PrewarmCount = Prewarm;
+		Def->SimClearSec = SimClearSec;
+		Out.Add(Def);
+		return Def;
+	};
+
+	UNSWorkTypeDef* Passenger = Make(WorkTypeId(EWorkType::Passenger), TEXT("Passenger"), EWorkSpawnMode::PooledAtPoint, PassengerTag, PassengerClass,
+		&FStageQuota::PassengerTotal, CooldownSec.Passenger, PrewarmPassengers, 0.f);
+	Passenger->bCountsAsWork = false;
+	Passenger->bKeepAwayFromPlayers = false;
+	Passenger->OccupancyHoldSec = PassengerHoldSec;
+
+	UNSWorkTypeDef* Stain = Make(WorkTypeId(EWorkType::Stain), TEXT("Stain"), EWorkSpawnMode::StainAtPoint, StainTag, MemoryStainClass,
+		&FStageQuota::StainTotal, CooldownSec.Stain, PrewarmStains, 6.f);
+	Stain->MinSameTypeSpacing = StainMinSpacing;
+
+	Make(WorkTypeId(EWorkType::Repair), TEXT("Repair"), EWorkSpawnMode::RepairPool, RepairTag, TSoftClassPtr<AActor>(),
+		&FStageQuota::RepairTotal, CooldownSec.Repair, 0, 9.f);
+	Make(WorkTypeId(EWorkType::Shard), TEXT("Shard"), EWorkSpawnMode::PooledAtPoint, ShardTag, MemoryShardClass,
+		&FStageQuota::ShardTotal, CooldownSec.Shard, PrewarmShards, 3.f);
+}
+
+void ANSSpawnDirector::ResolveWorkTypes()
+{
+	MakeWorkTypes(ActiveWorkTypes);
+	if (ActiveWorkTypes.Num() > MaxWorkTypes)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[SPAWN] %d work types, only the first %d are used"), ActiveWorkTypes.Num(), MaxWorkTypes);
+		ActiveWorkTypes.SetNum(MaxWorkTypes);
+	}
+
+	RepairTypeId = INDEX_NONE;
+	FString Names;
+	for (int32 T = 0; T < ActiveWorkTypes.Num(); ++T)
+	{
+		const UNSWorkTypeDef* Def = ActiveWorkTypes[T];
+		Names += FString::Printf(TEXT(" %d:%s"), T, *Def->GetTypeName().ToString());
+		if (Def->SpawnMode != EWorkSpawnMode::RepairPool) continue;
+
+		if (RepairTypeId == INDEX_NONE) RepairTypeId = T;
+		else UE_LOG(LogTemp, Warning, TEXT("[SPAWN] %s: only one RepairPool type is supported, ignored"), *Def->GetTypeName().ToString());
+	}
+
+	SpawnedCount.Init(0, ActiveWorkTypes.Num());
+	PendingCount.Init(0, ActiveWorkTypes.Num());
+	UE_LOG(LogTemp, Log, TEXT("[SPAWN] Work types:%s"), *Names);
+}
+
+const UNSWorkTypeDef* ANSSpawnDirector::GetWorkTypeDef(FNSWorkTypeId Type) const
+{
+	return ActiveWorkTypes.IsValidIndex(int32(Type)) ? ActiveWorkTypes[int32(Type)].Get() : nullptr;
+}
+
+bool ANSSpawnDirector::IsQuotaFull(FNSWorkTypeId Type, bool bScaled) const
+{
+	const int32 T = int32(Type);
+	const int32 BaseQuota = ActiveWorkTypes[T]->GetQuota(CurrentStage);
+	const int32 Quota = bScaled ? Pacing.ScaleQuota(BaseQuota) : BaseQuota;
+	if (SpawnedCount[T] + PendingCount[T] < Quota) return false;
+
+	UE_LOG(LogTemp, Verbose, TEXT("[SPAWN][%s] quota full %d/%d"), *ActiveWorkTypes[T]->GetTypeName().ToString(), SpawnedCount[T], Quota);
+	return true;
+}
+
+void ANSSpawnDirector::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	if (UNSWorkItemSubsystem* Items = GetWorkItems())
+	{
+		Items->OnItemResolved.Remove(ItemResolvedHandle);
+	}
+	if (UNSWorkPoolSubsystem* Pool = GetWorkPool())
+	{
+		Pool->OnWorkCompleted.Remove(WorkCompletedHandle);
+	}
+
+	// 라운드 도중 종료(서버 셧다운 등)여도 그날 집계는 남김
+	if (bActive) FlushTelemetry();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ANSSpawnDirector::BeginSpawnLoop(float InRoundLengthSec)
+{
+	if (!HasAuthority()) return;
+
+	bActive = true;
+	ElapsedSec = 0.f;
+	DayStartSec = float(GetWorld()->GetTimeSeconds());
+	NextWakeSec = 0.f;
+	ScheduleClock = ClockSyncSec = NextWakeClock = 0.f;
+	Pacing.Reset();
+	CurrentStage = ESpawnStage::Early;
+	SpawnedCount.Init(0, ActiveWorkTypes.Num());
+	CancelVisibilityChecks();
+	ResetSpawnQueue();
+
+	float CellSize = PointClearance;
+	for (const UNSWorkTypeDef* Def : ActiveWorkTypes)
+	{
+		CellSize = FMath::Max(CellSize, Def->MinSameTypeSpacing);
+	}
+	Occupancy.Init(CellSize);
+	SkippedOccupied = 0;
+	SkippedVisible = 0;
+
+	if (bWriteTelemetry && !Telemetry.IsOpen()) OpenTelemetry();
+	Telemetry.ResetDay();
+	NextTelemetrySampleSec = 0.f;
+
+	// Waiting/Starting 동안 끝났어야 정상. 아니면 여기서 한 번 기다림(첫 스폰 히치 방지)
+	if (!bSpawnAssetsReady)
+	{
+		PreloadSpawnAssets();
+		if (PreloadHandle.IsValid())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SPAWN] Spawn assets not resident at BeginSpawnLoop - blocking"));
+			PreloadHandle->WaitUntilComplete();
+		}
+		OnSpawnAssetsLoaded();
+	}
+	PeakQueueDepth = 0;
+	MaxDrainMs = 0.f;
+
+	BuildRepairPool();  // 풀 만들기
+	RescanAllLevels();
+	BuildSpawnPointTable();
+
+	// 오늘 스케줄을 시드로 한 번에 계산 (재현용으로 seed 로그)
+	int32 Seed = ScheduleSeed;
+	FParse::Value(FCommandLine::Get(), TEXT("SpawnSeed="), Seed);
+	if (Seed == 0)
+	{
+		Seed = int32(FPlatformTime::Cycles() & 0x7fffffff) | 1;
+	}
+	Schedule.Build(MakeScheduleParams(), Seed);
+	SpawnRng.Initialize(Seed);
+
+	// 라운드 길이에 맞춰 세그먼트 수정하고 싶으면 여기서 Early/Peak/CleanupEndSec 조정
+	UE_LOG(LogTemp, Log, TEXT("[SPAWN] BeginSpawnLoop seed=%d events=%d"), Seed, Schedule.Events.Num());
+
+	GetWorldTimerManager().SetTimer(PacingHandle, this, &ANSSpawnDirector::SamplePacing, FMath::Max(0.1f, PacingConfig.SampleSec), true);
+	GetWorldTimerManager().SetTimer(WorkStatusHandle, this, &ANSSpawnDirector::RefreshWorkStatus, FMath::Max(0.05f, WorkStatusSampleSec), true);
+
+	// 0초 이벤트 즉시 실행 후 다음 깨움 예약
+	OnScheduleWake();
+}
+
+FNSSpawnScheduleParams ANSSpawnDirector::MakeScheduleParams()
+{
+	FNSSpawnScheduleParams P;
+	FillScheduleConfig(P);
+
+	for (int32 T = 0; T < ActiveWorkTypes.Num(); ++T)
+	{
+		const UNSWorkTypeDef* Def = ActiveWorkTypes[T];
+		if (Def->SpawnMode == EWorkSpawnMode::RepairPool)
+		{
+			P.Types[T].PointCount = RepairPool.Num();
+			continue;
+		}
+
+		const FSpawnPointSet* Set = GetSpawnPoints(Def->SpawnTag);
+		P.Types[T].PointCount = Set ? Set->Num() : 0;
+		// 얼룩 타입 미리 뽑기용 마스크 (얼룩 모드 타입이 여럿이면 첫 번째 기준)
+		if (Set && Def->SpawnMode == EWorkSpawnMode::StainAtPoint && P.StainMasks.Num() == 0)
+		{
+			P.StainMasks = Set->StainMasks;
+		}
+	}
+	return P;
+}
+
+void ANSSpawnDirector::FillScheduleConfig(FNSSpawnScheduleParams& P) const
+{
+	P.StageEndSec[0] = EarlyEndSec;
+	P.StageEndSec[1] = PeakEndSec;
+	P.StageEndSec[2] = CleanupEndSec;
+
+	// 런타임이면 확정된 목록, CDO(시뮬레이터)면 그 자리에서 만든 목록
+	TArray<TObjectPtr<UNSWorkTypeDef>> Made;
+	if (ActiveWorkTypes.Num() == 0) MakeWorkTypes(Made);
+	const TArray<TObjectPtr<UNSWorkTypeDef>>& Defs = ActiveWorkTypes.Num() > 0 ? ActiveWorkTypes : Made;
+
+	P.Types.SetNum(Defs.Num());
+	for (int32 T = 0; T < Defs.Num(); ++T)
+	{
+		const UNSWorkTypeDef* Def = Defs[T];
+		FNSScheduleWorkType& Out = P.Types[T];
+		for (int32 S = 0; S < NumSpawnStages; ++S)
+		{
+			Out.Quota[S] = Def->GetQuota(ESpawnStage(S + 1));
+		}
+		Out.CooldownSec = Def->CooldownSec;
+		Out.bPoolPick = Def->SpawnMode == EWorkSpawnMode::RepairPool;
+		Out.bStainTypes = Def->SpawnMode == EWorkSpawnMode::StainAtPoint;
+	}
+}
+
+void ANSSpawnDirector::RescanAllLevels()
+{
+	LevelPointBuckets.Reset();
+	StreamedCellPoints.Reset();
+	for (ULevel* Level : GetWorld()->GetLevels())
+	{
+		ScanLevelPoints(Level);
+	}
+	bSpawnPointsDirty = true;
+}
+
+void ANSSpawnDirector::ScanLevelPoints(ULevel* Level)
+{
+	if (!Level) return;
+
+	const FName LevelName = UNSSpawnPointAsset::GetLevelName(Level);
+	TMap<FName, FSpawnPointSet> Bucket;
+
+	// 구운 에셋이 있으면 액터를 훑지 않음. 보통 PreloadSpawnAssets로 이미 상주
+	const UNSSpawnPointAsset* Baked = SpawnPointAsset.IsNull() ? nullptr : SpawnPointAsset.LoadSynchronous();
+	if (Baked)
+	{
+		if (ScanStreamedCellPoints(*Baked, Level)) return;
+		AddBakedLevelPoints(*Baked, LevelName, Bucket);
+	}
+	else
+	{
+		if (!SpawnPointAsset.IsNull() && !bWarnedMissingPointAsset)
+		{
+			bWarnedMissingPointAsset = true;
+			UE_LOG(LogTemp, Error, TEXT("[SPAWN] SpawnPointAsset %s failed to load, scanning marker actors"), *SpawnPointAsset.ToString());
+		}
+
+		TArray<FName, TInlineAllocator<8>> Tags;
+		for (const UNSWorkTypeDef* Def : ActiveWorkTypes)
+		{
+			if (Def->SpawnMode != EWorkSpawnMode::RepairPool && !Def->SpawnTag.IsNone()) Tags.AddUnique(Def->SpawnTag);
+		}
+		for (const AActor* P : Level->Actors)
+		{
+			if (!IsValid(P) || P->Tags.Num() == 0) continue;
+			for (const FName Tag : Tags)
+			{
+				if (Tag.IsNone() || !P->ActorHasTag(Tag)) continue;
+				Bucket.FindOrAdd(Tag).Add(P->GetActorTransform(), GetAllowedStainTypesFromTags(P),
+					GetZoneIndex(UNSSpawnPointAsset::GetZoneName(P, LevelName)));
+			}
+		}
+	}
+
+	if (Bucket.Num() > 0)
+	{
+		for (auto& TagKV : Bucket) TagKV.Value.SortByLocation();
+		LevelPointBuckets.Add(Level, MoveTemp(Bucket));
+	}
+}
+
+void ANSSpawnDirector::AddBakedLevelPoints(const UNSSpawnPointAsset& Baked, FName LevelName, TMap<FName, FSpawnPointSet>& Bucket)
+{
+	const FNSBakedSpawnLevel* Range = Baked.FindLevel(LevelName);
+	if (!Range) return;
+
+	for (int32 i = Range->First; i < Range->First + Range->Num; ++i)
+	{
+		AddBakedPoint(Baked, i, Bucket);
+	}
+}
+
+void ANSSpawnDirector::AddBakedPoint(const UNSSpawnPointAsset& Baked, int32 Index, TMap<FName, FSpawnPointSet>& Bucket)
+{
+	const FNSBakedSpawnPoint& P = Baked.Points[Index];
+	if (!Baked.ZoneNames.IsValidIndex(P.Zone)) return;
+	// 에셋 구역 인덱스 → 디렉터 구역 인덱스
+	const int32 Zone = GetZoneIndex(Baked.ZoneNames[P.Zone]);
+
+	const FTransform Xform = P.ToTransform();
+	// 비트 = 베이크 당시 태그 인덱스 (타입 목록 순서와 무관)
+	for (uint32 Bits = P.TagMask; Bits; Bits &= Bits - 1)
+	{
+		const int32 TagIdx = FMath::CountTrailingZeros(Bits);
+		if (Baked.Tags.IsValidIndex(TagIdx)) Bucket.FindOrAdd(Baked.Tags[TagIdx]).Add(Xform, P.StainMask, Zone);
+	}
+}
+
+bool ANSSpawnDirector::ScanStreamedCellPoints(const UNSSpawnPointAsset& Baked, ULevel* Level)
+{
+	if (!Level->IsWorldPartitionRuntimeCell()) return false;
+
+	const UWorldPartitionRuntimeCell* Cell = Cast<UWorldPartitionRuntimeCell>(Level->GetWorldPartitionRuntimeCell());
+	const FNSBakedSpawnLevel* Range = Baked.FindLevel(UNSSpawnPointAsset::StreamedLevelName);
+	if (!Cell || !Range) return true;
+
+	// 그리드 셀은 XY로만 나뉨
+	const FBox Bounds = Cell->GetCellBounds();
+	TArray<int32> Indices;
+	for (int32 i = Range->First; i < Range->First + Range->Num; ++i)
+	{
+		if (Bounds.IsInsideOrOnXY(FVector(Baked.Points[i].Location))) Indices.Add(i);
+	}
+	if (Indices.Num() > 0)
+	{
+		StreamedCellPoints.Add(Level, MoveTemp(Indices));
+	}
+	return true;
+}
+
+void ANSSpawnDirector::GetSpawnTags(TArray<FName>& Out) const
+{
+	TArray<TObjectPtr<UNSWorkTypeDef>> Made;
+	if (ActiveWorkTypes.Num() == 0) MakeWorkTypes(Made);
+	for (const UNSWorkTypeDef* Def : ActiveWorkTypes.Num() > 0 ? ActiveWorkTypes : Made)
+	{
+		if (Def->SpawnMode != EWorkSpawnMode::RepairPool && !Def->SpawnTag.IsNone()) Out.AddUnique(Def->SpawnTag);
+	}
+}
+
+void ANSSpawnDirector::BuildSpawnPointTable()
+{
+	SpawnPointTable.Reset();
+
+	// 로드된 레벨 버킷만 이어 붙임 (월드 스캔 없음).
+	// TMap 순회 순서는 해시/스트리밍 순서를 따르므로 패키지 이름순으로 합쳐 PointIndex가 실행마다 같은 포인트를 가리키게
+	TArray<TPair<FString, const TMap<FName, FSpawnPointSet>*>> Ordered;
+	Ordered.Reserve(LevelPointBuckets.Num());
+	for (const auto& LevelKV : LevelPointBuckets)
+	{
+		const ULevel* Level = LevelKV.Key.ResolveObjectPtr();
+		if (!Level) continue;
+		Ordered.Emplace(Level->GetOutermost()->GetName(), &LevelKV.Value);
+	}
+	Algo::SortBy(Ordered, [](const auto& Pair) { return Pair.Key; });
+
+	for (const auto& Pair : Ordered)
+	{
+		for (const auto& TagKV : *Pair.Value)
+		{
+			SpawnPointTable.FindOrAdd(TagKV.Key).Append(TagKV.Value);
+		}
+	}
+
+	// WP 스트리밍 포인트: 로드된 셀들이 잡은 인덱스의 합집합 (겹치는 셀 중복 제거, 베이크 인덱스 순 → 결정적)
+	const UNSSpawnPointAsset* Baked = SpawnPointAsset.Get();
+	if (Baked && StreamedCellPoints.Num() > 0)
+	{
+		TBitArray<> Loaded(false, Baked->Points.Num());
+		for (const auto& CellKV : StreamedCellPoints)
+		{
+			for (const int32 i : CellKV.Value)
+			{
+				if (Loaded.IsValidIndex(i)) Loaded[i] = true;
+			}
+		}
+		TMap<FName, FSpawnPointSet> Streamed;
+		for (TConstSetBitIterator<> It(Loaded); It; ++It)
+		{
+			AddBakedPoint(*Baked, It.GetIndex(), Streamed);
+		}
+		for (const auto& TagKV : Streamed)
+		{
+			SpawnPointTable.FindOrAdd(TagKV.Key).Append(TagKV.Value);
+		}
+	}
+
+	for (const UNSWorkTypeDef* Def : ActiveWorkTypes)
+	{
+		if (Def->SpawnMode == EWorkSpawnMode::RepairPool) continue;
+		const FSpawnPointSet* Set = SpawnPointTable.Find(Def->SpawnTag);
+		UE_LOG(LogTemp, Log, TEXT("[SPAWN] Points with tag '%s' = %d (levels=%d)"),
+			*Def->SpawnTag.ToString(), Set ? Set->Num() : 0, LevelPointBuckets.Num());
+	}
+
+	bSpawnPointsDirty = false;
+}
+
+const FSpawnPointSet* ANSSpawnDirector::GetSpawnPoints(FName Tag)
+{
+	if (bSpawnPointsDirty)
+	{
+		BuildSpawnPointTable();
+	}
+	return SpawnPointTable.Find(Tag);
+}
+
+void ANSSpawnDirector::OnLevelAdded(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld()) return;
+	// 들어온 셀만 스캔, 합친 테이블은 다음 샘플 시점에 한 번만 재구성
+	ScanLevelPoints(Level);
+	bSpawnPointsDirty = true;
+}
+
+void ANSSpawnDirector::OnLevelRemoved(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld()) return;
+	// Level이 null이면 전체 제거 통지
+	if (!Level)
+	{
+		LevelPointBuckets.Reset();
+		StreamedCellPoints.Reset();
+	}
+	else if (LevelPointBuckets.Remove(Level) + StreamedCellPoints.Remove(Level) == 0) return;
+	bSpawnPointsDirty = true;
+}
+
+bool ANSSpawnDirector::IsRelevantToPlayers(const FVector& Pos) const
+{
+	// WP가 아니거나 꺼져 있으면 로드된 포인트 전부 후보
+	if (PlayerRelevanceRadius <= 0.f || !GetWorld()->GetWorldPartition()) return true;
+
+	const float RadiusSq = FMath::Square(PlayerRelevanceRadius);
+	bool bAnyPlayer = false;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APawn* Pawn = It->IsValid() ? (*It)->GetPawn() : nullptr;
+		if (!Pawn) continue;
+		bAnyPlayer = true;
+		if (FVector::DistSquared(Pawn->GetActorLocation(), Pos) <= RadiusSq) return true;
+	}
+	// 폰이 하나도 없으면(텔레포트/리스폰 중) 거르지 않음
+	return !bAnyPlayer;
+}
+
+void ANSSpawnDirector::BuildRepairPool()
+{
+	for (auto& W : RepairPool)
+	{
+		if (AInteractiveActor* R = W.Get())
+		{
+			R->OnBrokenChangedNative.RemoveAll(this);
+		}
+	}
+	RepairPool.Reset();
+	RepairIdle.Reset();
+	RepairBroken.Reset();
+	RepairListPos.Reset();
+
+	TArray<AActor*> Found;
+	// BP_RepairableActor(=AInteractiveActor 파생) + 태그로 수집
+	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AInteractiveActor::StaticClass(), Found);
+
+	for (AActor* A : Found)
+	{
+		if (!A || (RepairPoolTag != NAME_None && !A->ActorHasTag(RepairPoolTag))) continue;
+		AInteractiveActor* R = Cast<AInteractiveActor>(A);
+		if (!R) continue;
+
+		// 시작은 고장 아님
+		R->SetIsBroken(false);
+		// 수리 완료 시점 콜백
+		R->OnRepairCompleted.AddUniqueDynamic(this, &ANSSpawnDirector::OnRepairCompleted);
+
+		const int32 PoolIndex = RepairPool.Add(R);
+		RepairListPos.Add(RepairIdle.Add(PoolIndex));
+		// 고장/복구가 어디서 일어나든(QTE 완료, BP SetIsBroken) 목록 이동
+		R->OnBrokenChangedNative.AddUObject(this, &ANSSpawnDirector::OnRepairBrokenChanged, PoolIndex);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[SPAWN] RepairPool size=%d"), RepairPool.Num());
+}
+
+void ANSSpawnDirector::OnRepairBrokenChanged(AInteractiveActor* Who, bool bBroken, int32 PoolIndex)
+{
+	MoveRepairSlot(PoolIndex, bBroken);
+	if (RepairTypeId == INDEX_NONE) return;
+
+	// 고장 = 살아 있는 수리 업무. 복구(QTE 완료/정리)되면 해제
+	if (bBroken)
+	{
+		Work.Register(Who, FNSWorkTypeId(RepairTypeId), ElapsedSec);
+		PublishWorkStatus(Who->GetUniqueID(), FNSWorkTypeId(RepairTypeId), Who->GetActorLocation());
+		return;
+	}
+	// 라운드 중 복구만 완료로 집계 (EndSpawnLoop 뒤 DeactivateAllWork 정리는 제외)
+	const FNSWorkRecord* R = bActive ? Work.Get(Work.Find(Who)) : nullptr;
+	if (R) Telemetry.RecordResolved(R->Type, ElapsedSec - R->SpawnedAt);
+	Work.Unregister(Who);
+	if (ANSGameState* GS = GetStatusFeed()) GS->RemoveWorkStatus(Who->GetUniqueID());
+}
+
+void ANSSpawnDirector::MoveRepairSlot(int32 PoolIndex, bool bBroken)
+{
+	if (!RepairListPos.IsValidIndex(PoolIndex)) return;
+
+	TArray<int32>& From = bBroken ? RepairIdle : RepairBroken;
+	TArray<int32>& To = bBroken ? RepairBroken : RepairIdle;
+	const int32 Pos = RepairListPos[PoolIndex];
+	if (!From.IsValidIndex(Pos) || From[Pos] != PoolIndex) return; // 이미 반대쪽 목록
+
+	DropRepairSlot(From, Pos);
+	RepairListPos[PoolIndex] = To.Add(PoolIndex);
+}
+
+void ANSSpawnDirector::DropRepairSlot(TArray<int32>& List, int32 Pos)
+{
+	const int32 PoolIndex = List[Pos];
+	List.RemoveAtSwap(Pos, 1, EAllowShrinking::No);
+	if (List.IsValidIndex(Pos))
+	{
+		RepairListPos[List[Pos]] = Pos;   // 끝에서 당겨온 항목 위치 갱신
+	}
+	RepairListPos[PoolIndex] = INDEX_NONE;
+}
+
+bool ANSSpawnDirector::ActivateRandomRepair(int32 Pick, FNSWorkTypeId Type)
+{
+	// 이미 최대치면 패스
+	if (CountActiveRepairs() >= MaxSimultaneousRepairs)
+	{
+		RecordSpawnFail(Type, ESpawnFailReason::QuotaFull);
+		return false;
+	}
+
+	while (RepairIdle.Num() > 0)
+	{
+		const int32 Pos = (Pick & MAX_int32) % RepairIdle.Num();
+		AInteractiveActor* R = RepairPool[RepairIdle[Pos]].Get();
+		if (!R)
+		{
+			// 파괴된 액터는 목록에서만 빼고 다시 고름
+			DropRepairSlot(RepairIdle, Pos);
+			continue;
+		}
+
+		R->SetIsBroken(true);   // OnBrokenChangedNative → 고장 목록 이동 + 레지스트리 등록
+		SpawnedCount[int32(Type)]++;
+		Telemetry.RecordSuccess(Type, CurrentStage);
+		UE_LOG(LogTemp, Log, TEXT("[SPAWN] ActivateRepair %s"), *R->GetName());
+		return true;
+	}
+	RecordSpawnFail(Type, ESpawnFailReason::NoPoint);
+	return false;
+}
+
+void ANSSpawnDirector::OnRepairCompleted(AInteractiveActor* Who)
+{
+	const UNSWorkTypeDef* Def = GetWorkTypeDef(FNSWorkTypeId(RepairTypeId));
+	if (Def && Who && bActive)
+	{
+		Def->OnWorkCompleted(Who, this);
+	}
+	UE_LOG(LogTemp, Log, TEXT("[SPAWN] RepairCompleted %s Alive=%d"),
+		Who ? *Who->GetName() : TEXT("Unknown"), Def ? Work.Count(FNSWorkTypeId(RepairTypeId)) : 0);
+}
+
+void ANSSpawnDirector::EndSpawnLoop()
+{
+	if (!HasAuthority()) return;
+	bActive = false;
+	GetWorldTimerManager().ClearTimer(WakeHandle);
+	GetWorldTimerManager().ClearTimer(PacingHandle);
+	GetWorldTimerManager().ClearTimer(WorkStatusHandle);
+	ESpawnStage Prev = CurrentStage;
+	CurrentStage = ESpawnStage::Inactive;
+	UE_LOG(LogTemp, Log, TEXT("[SPAWN] EndSpawnLoop seed=%d executed=%d/%d queued=%d peakQueue=%d maxDrain=%.2fms occupiedSkips=%d"),
+		Schedule.Seed, Schedule.Cursor, Schedule.Events.Num(), GetQueueDepth(), PeakQueueDepth, MaxDrainMs, SkippedOccupied);
+	UE_LOG(LogTemp, Log, TEXT("[SPAWN] Pacing minRate=%.2f clock=%.0fs/%.0fs visibleSkips=%d"), Pacing.MinRateSeen, ScheduleClock, ElapsedSec, SkippedVisible);
+	CancelVisibilityChecks();
+	ResetSpawnQueue();
+	FlushTelemetry();
+
+	if (const UNSWorkPoolSubsystem* Pool = GetWorkPool())
+	{
+		Pool->LogStats();
+	}
+}
+
+void ANSSpawnDirector::OnScheduleWake()
+{
+	if (!IsServerActive()) return;
+
+	// 타이머 오차로 예약 시각보다 살짝 이르게 깨도 예약 시각까지는 도래한 것으로 본다
+	ElapsedSec = FMath::Max(float(GetWorld()->GetTimeSeconds()) - DayStartSec, NextWakeSec);
+	SyncClocks();
+	ScheduleClock = FMath::Max(ScheduleClock, NextWakeClock);
+
+	ESpawnStage Before = CurrentStage;
+	UpdateStage();
+	if (Before != CurrentStage)
+	{
+		LogStageChange(Before, CurrentStage);
+		PublishStage();
+	}
+
+	TrySpawnTick(ScheduleClock);
+	ArmNextWake();
+}
+
+void ANSSpawnDirector::SyncClocks()
+{
+	ScheduleClock += FMath::Max(0.f, ElapsedSec - ClockSyncSec) * Pacing.Rate;
+	ClockSyncSec = ElapsedSec;
+}
+
+float ANSSpawnDirector::GetFrameBudgetMs() const
+{
+	if (PacingConfig.FrameBudgetMs > 0.f) return PacingConfig.FrameBudgetMs;
+
+	const UNetDriver* Driver = GetWorld()->GetNetDriver();
+	const int32 TickRate = Driver ? Driver->GetNetServerMaxTickRate() : 30;
+	return 1000.f / FMath::Max(1, TickRate);
+}
+
+void ANSSpawnDirector::SamplePacing()
+{
+	if (!IsServerActive()) return;
+
+	// 지금까지는 이전 속도로 흐른 것으로 정산
+	ElapsedSec = FMath::Max(ElapsedSec, float(GetWorld()->GetTimeSeconds()) - DayStartSec);
+	SyncClocks();
+
+	// 틱레이트 대기(idle)를 뺀 실제 프레임 작업시간
+	const float FrameMs = float(FMath::Max(0.0, FApp::GetDeltaTime() - FApp::GetIdleTime()) * 1000.0);
+	const ANSGameState* GS = GetWorld()->GetGameState<ANSGameState>();
+	const int32 Players = GS ? FMath::Max(GS->TotalPlayers, GS->PlayerArray.Num()) : 1;
+
+	if (Telemetry.IsOpen() && ElapsedSec >= NextTelemetrySampleSec)
+	{
+		Telemetry.SampleAlive(ElapsedSec, CurrentStage, Work, ActiveWorkTypes.Num());
+		if (const UNetDriver* Driver = GetWorld()->GetNetDriver())
+		{
+			Telemetry.SampleNet(ElapsedSec, CurrentStage, Driver->IsUsingIrisReplication(), FrameMs,
+				Driver->OutBytesPerSecond / 1024.f, Driver->ClientConnections.Num());
+		}
+		NextTelemetrySampleSec = ElapsedSec + FMath::Max(0.5f, TelemetrySampleSec);
+	}
+
+	const float OldRate = Pacing.Rate;
+	const float OldQuota = Pacing.QuotaScale;
+	Pacing.Update(PacingConfig, FrameMs, GetFrameBudgetMs(), Players, GetAliveWorkCount());
+
+	if (!FMath::IsNearlyEqual(OldRate, Pacing.Rate, 0.05f) || !FMath::IsNearlyEqual(OldQuota, Pacing.QuotaScale, 0.05f))
+	{
+		UE_LOG(LogTemp, Log, TEXT("[SPAWN] Pacing rate=%.2f quota=%.2f frame=%.1f/%.1fms players=%d backlog=%d"),
+			Pacing.Rate, Pacing.QuotaScale, Pacing.SmoothedFrameMs, GetFrameBudgetMs(), Players, GetAliveWorkCount());
+	}
+	if (OldRate != Pacing.Rate)
+	{
+		// 다음 이벤트까지 실제 대기시간이 바뀜
+		ArmNextWake();
+	}
+}
+
+void ANSSpawnDirector::ArmNextWake()
+{
+	FTimerManager& TM = GetWorldTimerManager();
+	TM.ClearTimer(WakeHandle);
+	if (!IsServerActive() || CurrentStage == ESpawnStage::Inactive) return;
+
+	// 스케줄이 시간순이라 커서 위치가 곧 최소값. 스케줄 시계 → 실제 시간 환산 후 스테이지 경계와 비교
+	const float EventSec = Schedule.IsDone() ? MAX_flt
+		: ElapsedSec + FMath::Max(0.f, Schedule.NextTime() - ScheduleClock) / Pacing.Rate;
+	const float StageEndSec = GetStageEndSec(CurrentStage);
+	NextWakeSec = FMath::Min(EventSec, StageEndSec);
+	NextWakeClock = (EventSec <= StageEndSec) ? Schedule.NextTime() : 0.f;
+	TM.SetTimer(WakeHandle, this, &ANSSpawnDirector::OnScheduleWake, FMath::Max(NextWakeSec - ElapsedSec, KINDA_SMALL_NUMBER), false);
+}
+
+float ANSSpawnDirector::GetStageEndSec(ESpawnStage Stage) const
+{
+	switch (Stage)
+	{
+	case ESpawnStage::Early:   return EarlyEndSec;
+	case ESpawnStage::Peak:    return PeakEndSec;
+	case ESpawnStage::Cleanup: return CleanupEndSec;
+	default:                   return MAX_flt;
+	}
+}
+
+void ANSSpawnDirector::PublishStage() const
 {
-	Super::BeginPlay();
-	
+	// 스테이지 복제는 GS에서. 바뀔 때만 밀어줌
+	if (ANSGameState* GS = GetWorld()->GetGameState<ANSGameState>())
+	{
+		if (GS->SpawnStage != CurrentStage)
+		{
+			GS->SetSpawnStage(CurrentStage);
+			GS->ForceNetUpdate();
+		}
+	}
 }
 
-void ANSSpawnDirector::BeginSpawnLoop(float InRoundLengthSec)
+void ANSSpawnDirector::UpdateStage()
 {
-	if (!HasAuthority()) return;
-
-	bActive = true;
-	ElapsedSec = 0.f;
-	CurrentStage = ESpawnStage::Early;
-	Spawned = FStageQuota{};
-	Alive = FStageQuota{};
-	NextPassengerTime = NextStainTime = NextRepairTime = 0.f;
-
-	BuildRepairPool();  // 풀 만들기
-
-	// 라운드 길이에 맞춰 세그먼트 수정하고 싶으면 여기서 Early/Peak/CleanupEndSec 조정
-	UE_LOG(LogTemp, Log, TEXT("[SPAWN] BeginSpawnLoop"));
-
-	TArray<AActor*> Tmp;
-	UGameplayStatics::GetAllActorsWithTag(GetWorld(), StainTag, Tmp);
-	UE_LOG(LogTemp, Log, TEXT("[SPAWN] Stain points with tag '%s' = %d"), *StainTag.ToString(), Tmp.Num());
+	if (ElapsedSec < EarlyEndSec)            CurrentStage = ESpawnStage::Early;
+	else if (ElapsedSec < PeakEndSec)        CurrentStage = ESpawnStage::Peak;
+	else if (ElapsedSec < CleanupEndSec)     CurrentStage = ESpawnStage::Cleanup;
+	else                                     CurrentStage = ESpawnStage::Inactive;
 }
 
-void ANSSpawnDirector::BuildRepairPool()
+void ANSSpawnDirector::TrySpawnTick(float Now)
 {
-	RepairPool.Reset();
-
-	TArray<AActor*> Found;
-	// BP_RepairableActor(=AInteractiveActor 파생) + 태그로 수집
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AInteractiveActor::StaticClass(), Found);
+	if (CurrentStage == ESpawnStage::Inactive) return;
 
-	for (AActor* A : Found)
+	// 스케줄 커서: 도래한 이벤트는 큐로만 넘기고 실제 스폰은 Tick에서 예산만큼
+	while (const FNSSpawnEvent* Ev = Schedule.PeekDue(Now))
 	{
-		if (!A || (RepairPoolTag != NAME_None && !A->ActorHasTag(RepairPoolTag))) continue;
-		AInteractiveActor* R = Cast<AInteractiveActor>(A);
-		if (!R) continue;
+		SpawnQueue.Add(*Ev);
+		Schedule.Advance();
+	}
 
-		// 시작은 고장 아님
-		R->SetIsBroken(false);
-		// 수리 완료 시점 콜백
-		R->OnRepairCompleted.AddDynamic(this, &ANSSpawnDirector::OnRepairCompleted);
-		RepairPool.Add(R);
+	if (GetQueueDepth() > 0)
+	{
+		PeakQueueDepth = FMath::Max(PeakQueueDepth, GetQueueDepth());
+		SetActorTickEnabled(true);
 	}
+}
 
-	UE_LOG(LogTemp, Log, TEXT("[SPAWN] RepairPool size=%d"), RepairPool.Num());
+void ANSSpawnDirector::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+	DrainSpawnQueue();
 }
 
-int32 ANSSpawnDirector::CountActiveRepairs() const
+void ANSSpawnDirector::DrainSpawnQueue()
 {
-	int32 C = 0;
-	for (auto& W : RepairPool)
+	SCOPE_CYCLE_COUNTER(STAT_NSSpawnDrain);
+
+	if (!IsServerActive())
 	{
-		if (const AInteractiveActor* R = W.Get())
-		{
-			if (R->IsBroken()) ++C;
-		}
+		CancelVisibilityChecks();
+		ResetSpawnQueue();
+		return;
 	}
-	return C;
-}
 
-bool ANSSpawnDirector::ActivateRandomRepair()
-{
-	// 이미 최대치면 패스
-	if (CountActiveRepairs() >= MaxSimultaneousRepairs) return false;
+	ElapsedSec = FMath::Max(ElapsedSec, float(GetWorld()->GetTimeSeconds()) - DayStartSec);
+	SyncClocks();
 
-	TArray<AInteractiveActor*> Candidates;
-	for (auto& W : RepairPool)
+	const double StartSec = FPlatformTime::Seconds();
+	const double BudgetSec = SpawnBudgetMs * 0.001;
+	bool bRequeued = ResolveVisibilityChecks();
+	int32 Executed = 0;
+
+	// 최소 1건은 처리해서 예산이 작아도 큐가 굶지 않게
+	while (GetQueueDepth() > 0 && (Executed == 0 || FPlatformTime::Seconds() - StartSec < BudgetSec))
 	{
-		AInteractiveActor* R = W.Get();
-		if (R && !R->IsBroken())
+		FNSSpawnEvent Ev = SpawnQueue[SpawnQueueHead++];
+		++Executed;
+
+		bool bOk;
+		{
+			SCOPE_CYCLE_COUNTER(STAT_NSSpawnEvent);
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			bOk = ExecuteSpawnEvent(Ev);
+			if (int32(Ev.Type) < ActiveWorkTypes.Num())
+			{
+				Telemetry.RecordSpawnCost(Ev.Type, FPlatformTime::Cycles64() - StartCycles);
+			}
+		}
+		if (!bOk)
 		{
-			Candidates.Add(R);
+			RequeueFailedEvent(Ev);
+			bRequeued = true;
 		}
 	}
-	if (Candidates.Num() == 0) return false;
 
-	AInteractiveActor* Pick = Candidates[FMath::RandHelper(Candidates.Num())];
-	Pick->SetIsBroken(true);
-	Alive.RepairTotal++; Spawned.RepairTotal++;
-	UE_LOG(LogTemp, Log, TEXT("[SPAWN] ActivateRepair %s"), *Pick->GetName());
-	return true;
+	const float DrainMs = float((FPlatformTime::Seconds() - StartSec) * 1000.0);
+	MaxDrainMs = FMath::Max(MaxDrainMs, DrainMs);
+	SET_DWORD_STAT(STAT_NSSpawnQueueDepth, GetQueueDepth());
+	SET_DWORD_STAT(STAT_NSSpawnsThisFrame, Executed);
+	SET_FLOAT_STAT(STAT_NSSpawnDrainMs, DrainMs);
+	SET_DWORD_STAT(STAT_NSSpawnLosPending, PendingVisibility.Num());
+
+	if (GetQueueDepth() == 0)
+	{
+		ResetSpawnQueue();
+	}
+	if (bRequeued)
+	{
+		// 되돌린 이벤트가 예약된 깨움보다 이를 수 있음
+		ArmNextWake();
+	}
 }
 
-void ANSSpawnDirector::OnRepairCompleted(AInteractiveActor* Who)
+void ANSSpawnDirector::ResetSpawnQueue()
 {
-	Alive.RepairTotal = FMath::Max(0, Alive.RepairTotal - 1);
-	UE_LOG(LogTemp, Log, TEXT("[SPAWN] RepairCompleted %s Alive=%d"),
-		Who ? *Who->GetName() : TEXT("Unknown"), Alive.RepairTotal);
+	SpawnQueue.Reset();
+	SpawnQueueHead = 0;
+	// 시야 판정 대기 중이면 결과 받을 때까지 Tick 유지
+	SetActorTickEnabled(PendingVisibility.Num() > 0);
 }
 
-void ANSSpawnDirector::EndSpawnLoop()
+void ANSSpawnDirector::RequeueFailedEvent(const FNSSpawnEvent& Ev)
 {
-	if (!HasAuthority()) return;
-	bActive = false;
-	ESpawnStage Prev = CurrentStage;
-	CurrentStage = ESpawnStage::Inactive;
-	UE_LOG(LogTemp, Log, TEXT("[SPAWN] EndSpawnLoop"));
+	FNSSpawnEvent Retry = Ev;
+	Retry.Time = FMath::Max(Ev.Time, ScheduleClock) + FMath::Max(0.1f, RetryDelaySec);
+	Schedule.Requeue(Retry);
 }
 
-void ANSSpawnDirector::Tick(float DeltaSeconds)
+bool ANSSpawnDirector::RequestVisibilityCheck(const FNSSpawnEvent& Ev, const FTransform& Xform, uint8 StainMask, int32 Zone)
 {
-	Super::Tick(DeltaSeconds);
-	if (!IsServerActive()) return;
+	UWorld* World = GetWorld();
+	const FVector Target = Xform.GetLocation();
+	const float MaxDistSq = FMath::Square(VisibilityMaxDistance);
 
-	ElapsedSec += DeltaSeconds;
-	ESpawnStage Before = CurrentStage;
-	UpdateStage();
-	if (Before != CurrentStage)
+	TArray<FTraceHandle, TInlineAllocator<4>> Traces;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
 	{
-		LogStageChange(Before, CurrentStage);
+		const APlayerController* PC = It->Get();
+		if (!PC) continue;
+
+		FVector ViewLoc; FRotator ViewRot;
+		PC->GetPlayerViewPoint(ViewLoc, ViewRot);
+		const FVector ToTarget = Target - ViewLoc;
+		const float DistSq = ToTarget.SizeSquared();
+		if (VisibilityMaxDistance > 0.f && DistSq > MaxDistSq) continue;
+
+		const float Dist = FMath::Sqrt(DistSq);
+		const FVector End = Target - ToTarget.GetSafeNormal() * FMath::Min(VisibilityEndPullback, Dist * 0.5f);
+
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(NSSpawnVisibility), false);
+		Params.AddIgnoredActor(PC->GetPawn());
+		Traces.Add(World->AsyncLineTraceByChannel(EAsyncTraceType::Single, ViewLoc, End, VisibilityChannel, Params));
 	}
+	if (Traces.Num() == 0) return false;
+
+	INC_DWORD_STAT_BY(STAT_NSSpawnLosTraces, Traces.Num());
+
+	FPendingVisibility& P = PendingVisibility.AddDefaulted_GetRef();
+	P.Ev = Ev;
+	P.Xform = Xform;
+	P.StainMask = StainMask;
+	P.Zone = Zone;
+	P.IssuedFrame = GFrameCounter;
+	P.Traces = MoveTemp(Traces);
+	++PendingCount[int32(Ev.Type)];
+	return true;
+}
+
+bool ANSSpawnDirector::ResolveVisibilityChecks()
+{
+	UWorld* World = GetWorld();
+	bool bRequeued = false;
+
+	for (int32 i = 0; i < PendingVisibility.Num(); )
+	{
+		// 같은 프레임에 건 트레이스는 다음 프레임에야 결과가 나옴
+		if (PendingVisibility[i].IssuedFrame >= GFrameCounter) { ++i; continue; }
+
+		const FPendingVisibility P = MoveTemp(PendingVisibility[i]);
+		PendingVisibility.RemoveAt(i, 1, EAllowShrinking::No);
+		--PendingCount[int32(P.Ev.Type)];
 
-	const float Now = ElapsedSec;
-	TrySpawnTick(Now);
+		// 막힌 히트가 없는 트레이스 = 그 카메라에서 보임. 결과가 사라졌으면 보수적으로 보임 처리
+		bool bVisible = false;
+		for (const FTraceHandle& Handle : P.Traces)
+		{
+			FTraceDatum Datum;
+			if (!World->QueryTraceData(Handle, Datum)
+				|| !Datum.OutHits.ContainsByPredicate([](const FHitResult& H) { return H.bBlockingHit; }))
+			{
+				bVisible = true;
+				break;
+			}
+		}
+
+		bool bOk = false;
+		if (bVisible)
+		{
+			++SkippedVisible;
+			RecordSpawnFail(P.Ev.Type, ESpawnFailReason::Visible);
+		}
+		else if (!IsPointOccupied(P.Xform.GetLocation(), P.Ev.Type))
+		{
+			bOk = CommitAtPoint(P.Ev, P.Xform, P.StainMask, P.Zone);
+		}
+		else
+		{
+			RecordSpawnFail(P.Ev.Type, ESpawnFailReason::Collision);
+		}
+		if (!bOk)
+		{
+			RequeueFailedEvent(P.Ev);
+			bRequeued = true;
+		}
+	}
+	return bRequeued;
 }
 
-void ANSSpawnDirector::UpdateStage()
+void ANSSpawnDirector::CancelVisibilityChecks()
 {
-	if (ElapsedSec < EarlyEndSec)            CurrentStage = ESpawnStage::Early;
-	else if (ElapsedSec < PeakEndSec)        CurrentStage = ESpawnStage::Peak;
-	else if (ElapsedSec < CleanupEndSec)     CurrentStage = ESpawnStage::Cleanup;
-	else                                     CurrentStage = ESpawnStage::Inactive;
+	PendingVisibility.Reset();
+	for (int32& N : PendingCount) N = 0;
 }
 
-void ANSSpawnDirector::TrySpawnTick(float Now)
+bool ANSSpawnDirector::ExecuteSpawnEvent(FNSSpawnEvent& Ev)
 {
-	if (CurrentStage == ESpawnStage::Inactive) return;
+	// 정의가 사라진 타입(목록 변경)은 버림
+	const UNSWorkTypeDef* Def = GetWorkTypeDef(Ev.Type);
+	if (!Def) return true;
+
+	Telemetry.RecordAttempt(Ev.Type, CurrentStage);
+	if (IsQuotaFull(Ev.Type, /*bScaled*/false))
+	{
+		// 스테이지 원래 쿼터가 찼으면 이번 스테이지엔 재시도해도 같은 결과 → 한 번 기록하고 소모
+		if (!Ev.bQuotaDeferred) RecordSpawnFail(Ev.Type, ESpawnFailReason::QuotaFull);
+		return true;
+	}
+	if (IsQuotaFull(Ev.Type))
+	{
+		// 부하/인원으로 줄어든 쿼터만 참 → QuotaScale이 회복되면 나올 수 있으니 되돌림 (기록은 처음 한 번)
+		if (!Ev.bQuotaDeferred) RecordSpawnFail(Ev.Type, ESpawnFailReason::QuotaFull);
+		Ev.bQuotaDeferred = true;
+		return false;
+	}
 
-	// 타입별 쿨다운 체크 + 해당 스테이지 quota 미달 시 스폰
-	if (Now >= NextPassengerTime) if (TrySpawnPassenger()) NextPassengerTime = Now + CooldownSec.Passenger;
-	if (Now >= NextStainTime)     if (TrySpawnStain())     NextStainTime = Now + CooldownSec.Stain;
-	if (Now >= NextRepairTime)    if (ActivateRandomRepair())    NextRepairTime = Now + CooldownSec.Repair;
-	if (Now >= NextShardTime)     if (TrySpawnShard())     NextShardTime = Now + CooldownSec.Shard;
+	switch (Def->SpawnMode)
+	{
+	case EWorkSpawnMode::RepairPool: return ActivateRandomRepair(Ev.PointIndex, Ev.Type);
+	default:                         return TrySpawnAtPoint(Ev, *Def);
+	}
 }
 
-static const FStageQuota& GetQuotaFor(ESpawnStage Stage, const FStageQuota& E, const FStageQuota& P, const FStageQuota& C)
+bool ANSSpawnDirector::TrySpawnAtPoint(const FNSSpawnEvent& Ev, const UNSWorkTypeDef& Def)
 {
-	switch (Stage) { case ESpawnStage::Early: return E; case ESpawnStage::Peak: return P; default: return C; }
+	if (!Def.ActorClass.Get())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[SPAWN][%s] ActorClass not loaded (%s)"), *Def.GetTypeName().ToString(), *Def.ActorClass.ToString());
+		RecordSpawnFail(Ev.Type, ESpawnFailReason::NoClass);
+		return false;
+	}
+
+	FTransform T;
+	uint8 StainMask = 0;
+	int32 Zone = INDEX_NONE;
+	const int32 OccupiedBefore = SkippedOccupied;
+	if (!PickSpawnPoint(Def.SpawnTag, Ev.Type, Ev, T, StainMask, Zone))
+	{
+		// 점유 스킵이 늘었으면 후보는 있었는데 전부 막힘
+		RecordSpawnFail(Ev.Type, SkippedOccupied != OccupiedBefore ? ESpawnFailReason::Collision : ESpawnFailReason::NoPoint);
+		UE_LOG(LogTemp, Verbose, TEXT("[SPAWN][%s] no free point with tag '%s'"), *Def.GetTypeName().ToString(), *Def.SpawnTag.ToString());
+		return false;
+	}
+
+	if (bHideSpawnsFromPlayers && Def.bKeepAwayFromPlayers && RequestVisibilityCheck(Ev, T, StainMask, Zone)) return true;
+	return CommitAtPoint(Ev, T, StainMask, Zone);
 }
 
-bool ANSSpawnDirector::TrySpawnPassenger()
+bool ANSSpawnDirector::CommitAtPoint(const FNSSpawnEvent& Ev, const FTransform& T, uint8 StainMask, int32 Zone)
 {
-	const FStageQuota& Q = GetQuotaFor(CurrentStage, EarlyQuota, PeakQuota, CleanupQuota);
-	if (Spawned.PassengerTotal >= Q.PassengerTotal) return false;
+	const UNSWorkTypeDef* Def = GetWorkTypeDef(Ev.Type);
+	UClass* Cls = Def ? Def->ActorClass.Get() : nullptr;
+	if (!Cls)
+	{
+		if (Def) RecordSpawnFail(Ev.Type, ESpawnFailReason::NoClass);
+		return false;
+	}
+
+	EStainType StainType = EStainType::None;
+	if (Def->SpawnMode == EWorkSpawnMode::StainAtPoint)
+	{
+		// 스케줄 타입이 이 포인트에서 허용되면 그대로, 아니면(테이블 변경) 마스크에서 다시 선택
+		const bool bScheduledOk = Ev.StainType != EStainType::None && (StainMask == 0 || (StainMask & StainBit(Ev.StainType)));
+		StainType = bScheduledOk ? Ev.StainType : PickTypeForPoint(StainMask);
+	}
 
-	FTransform T; if (!FindRandomPointByTag(PassengerTag, T) || !*PassengerClass) return false;
-	AActor* A = GetWorld()->SpawnActorDeferred<AActor>(PassengerClass, T, this);
-	if (!A) return false;
-	UGameplayStatics::FinishSpawningActor(A, T);
+	if (Def->bActorless)
+	{
+		// 액터 대신 항목만. 플레이어가 상호작용할 때 그 자리에 Cls 액터가 뜬다
+		UNSWorkItemSubsystem* Items = GetWorkItems();
+		UMaterialInterface* Mat = (StainType != EStainType::None) ? GetStainBaseMaterial(StainType) : Def->ProxyMaterial.Get();
+		const FNSWorkItemHandle Item = Items ? Items->Add(Ev.Type, Cls, T, StainType, Def->ProxyMesh.Get(), Mat) : FNSWorkItemHandle();
+		if (!Item.IsValid())
+		{
+			RecordSpawnFail(Ev.Type, ESpawnFailReason::Collision);
+			return false;
+		}
+		TrackItem(Item, T.GetLocation(), Ev.Type, Zone);
+	}
+	else
+	{
+		AActor* A = (StainType != EStainType::None)
+			? SpawnStainAtPoint(Cls, T, StainType)
+			: GetWorkPool()->Acquire(Cls, T, this, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+		if (!A)
+		{
+			RecordSpawnFail(Ev.Type, ESpawnFailReason::Collision);
+			return false;
+		}
+		TrackWork(A, T.GetLocation(), Ev.Type, Zone);
+	}
+	Telemetry.RecordSuccess(Ev.Type, CurrentStage);
 
-	Spawned.PassengerTotal++; Alive.PassengerTotal++;
-	LogBatch(TEXT("Passenger"), Spawned.PassengerTotal);
+	LogBatch(Def->GetTypeName().ToString(), ++SpawnedCount[int32(Ev.Type)]);
 	return true;
 }
 
-bool ANSSpawnDirector::FindRandomPointByTagEx(FName Tag, FTransform& Out, AActor*& OutPoint) const
+bool ANSSpawnDirector::FindPointByTag(FName Tag, int32 PointIndex, FTransform& Out, uint8& OutStainMask)
 {
-	TArray<AActor*> Points;
-	UGameplayStatics::GetAllActorsWithTag(GetWorld(), Tag, Points);
-	if (Points.Num() == 0) { OutPoint = nullptr; return false; }
-	OutPoint = Points[FMath::RandHelper(Points.Num())];
-	Out = OutPoint->GetActorTransform();
+	const FSpawnPointSet* Points = GetSpawnPoints(Tag);
+	if (!Points || Points->Num() == 0) { OutStainMask = 0; return false; }
+	// 스트리밍으로 테이블 크기가 바뀌어도 같은 인덱스는 같은 위치로
+	const int32 Idx = (PointIndex == INDEX_NONE) ? SpawnRng.RandHelper(Points->Num()) : PointIndex % Points->Num();
+	Out = Points->Transforms[Idx];
+	OutStainMask = Points->StainMasks[Idx];
 	return true;
 }
 
-bool ANSSpawnDirector::TrySpawnStain()
+int32 ANSSpawnDirector::GetZoneIndex(FName ZoneName)
 {
-	const FStageQuota& Q = GetQuotaFor(CurrentStage, EarlyQuota, PeakQuota, CleanupQuota);
-	if (Spawned.StainTotal >= Q.StainTotal) {
-		UE_LOG(LogTemp, Verbose, TEXT("[SPAWN][Stain] quota full %d/%d"), Spawned.StainTotal, Q.StainTotal);
-		return false;
+	if (const int32* Found = ZoneIndexByName.Find(ZoneName)) return *Found;
+	const int32 Index = ZoneIndexByName.Num();
+	ZoneIndexByName.Add(ZoneName, Index);
+	ZoneLoad.SetNumZeroed(ZoneIndexByName.Num());
+	return Index;
+}
+
+void ANSSpawnDirector::AdjustZoneLoad(int32 Zone, int32 Delta)
+{
+	if (ZoneLoad.IsValidIndex(Zone)) ZoneLoad[Zone] = FMath::Max(0, ZoneLoad[Zone] + Delta);
+}
+
+bool ANSSpawnDirector::PickSpawnPoint(FName Tag, FNSWorkTypeId Type, const FNSSpawnEvent& Ev, FTransform& Out, uint8& OutStainMask, int32& OutZone)
+{
+	if (!PointScoring.bEnabled)
+	{
+		return FindFreePointByTag(Tag, Type, Ev.PointIndex, Out, OutStainMask, OutZone);
 	}
 
-	FTransform T;
-	AActor* SpawnPoint = nullptr;
+	SCOPE_CYCLE_COUNTER(STAT_NSSpawnScore);
 
-	if (!FindRandomPointByTagEx(StainTag, T, SpawnPoint)) {
-		UE_LOG(LogTemp, Error, TEXT("[SPAWN][Stain] no points with tag '%s'"), *StainTag.ToString());
-		return false;
+	const FSpawnPointSet* Points = GetSpawnPoints(Tag);
+	if (!Points || Points->Num() == 0) { OutStainMask = 0; return false; }
+	const int32 N = Points->Num();
+
+	// 플레이어 폰 위치 SoA
+	TArray<float, TInlineAllocator<8>> PX, PY, PZ;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APawn* Pawn = It->IsValid() ? (*It)->GetPawn() : nullptr)
+		{
+			const FVector L = Pawn->GetActorLocation();
+			PX.Add(float(L.X)); PY.Add(float(L.Y)); PZ.Add(float(L.Z));
+		}
 	}
+	const int32 NumPlayers = PX.Num();
+
+	const UNSWorkTypeDef* Def = GetWorkTypeDef(Type);
+	const bool bAvoidPlayers = Def && Def->bKeepAwayFromPlayers && PointScoring.PreferOutsideRadius > 0.f;
+	const float NearSq = FMath::Square(PointScoring.PreferOutsideRadius);
+	const float NearWeight = PointScoring.NearPlayerWeight;
+	const bool bRelevance = PlayerRelevanceRadius > 0.f && GetWorld()->GetWorldPartition() != nullptr && NumPlayers > 0;
+	const float RelevantSq = FMath::Square(PlayerRelevanceRadius);
+	const float ZoneBalance = PointScoring.ZoneBalance;
+
+	const float* RESTRICT Xs = Points->X.GetData();
+	const float* RESTRICT Ys = Points->Y.GetData();
+	const float* RESTRICT Zs = Points->Z.GetData();
+	const int32* RESTRICT ZoneIds = Points->Zones.GetData();
+	const int32* RESTRICT Loads = ZoneLoad.GetData();
+	const int32 NumZones = ZoneLoad.Num();
+
+	ScoreScratch.SetNumUninitialized(N, EAllowShrinking::No);
+	float* RESTRICT W = ScoreScratch.GetData();
+
+	// 포인트 청크 단위 병렬: 순수 산술만 (점유 해시 조회는 샘플된 후보에만)
+	constexpr int32 ChunkSize = 256;
+	const int32 NumChunks = (N + ChunkSize - 1) / ChunkSize;
+	ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const int32 Begin = Chunk * ChunkSize;
+			const int32 End = FMath::Min(N, Begin + ChunkSize);
+			for (int32 i = Begin; i < End; ++i)
+			{
+				float MinSq = MAX_flt;
+				for (int32 p = 0; p < NumPlayers; ++p)
+				{
+					const float DX = Xs[i] - PX[p], DY = Ys[i] - PY[p], DZ = Zs[i] - PZ[p];
+					MinSq = FMath::Min(MinSq, DX * DX + DY * DY + DZ * DZ);
+				}
+
+				float Score = (bRelevance && MinSq > RelevantSq) ? 0.f : 1.f;
+				if (bAvoidPlayers && MinSq < NearSq) Score *= NearWeight;
+
+				const int32 Zone = ZoneIds[i];
+				const int32 Load = (Zone >= 0 && Zone < NumZones) ? Loads[Zone] : 0;
+				W[i] = Score / (1.f + ZoneBalance * Load);
+			}
+		}, N < PointScoring.ParallelMinPoints ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
-	if (!*MemoryStainClass) {
-		UE_LOG(LogTemp, Error, TEXT("[SPAWN][Stain] MemoryStainClass is None (set BP_MemoryStain on Director/BP)"));
-		return false;
+	// 누적합 → PointRoll로 가중치 샘플링. 점유된 후보면 황금비 간격으로 다른 롤 재시도
+	float Total = 0.f;
+	for (int32 i = 0; i < N; ++i) { Total += W[i]; W[i] = Total; }
+	if (Total <= 0.f) { ++SkippedOccupied; return false; }
+
+	const TArrayView<const float> Cumulative(W, N);
+	for (int32 k = 0; k < MaxPointProbes; ++k)
+	{
+		const float Roll = FMath::Frac(Ev.PointRoll + k * 0.618034f) * Total;
+		const int32 Idx = FMath::Min(Algo::UpperBound(Cumulative, Roll), N - 1);
+		if (IsPointOccupied(Points->Transforms[Idx].GetLocation(), Type)) continue;
+
+		Out = Points->Transforms[Idx];
+		OutStainMask = Points->StainMasks[Idx];
+		OutZone = Points->Zones[Idx];
+		return true;
 	}
 
-	if (!FindRandomPointByTagEx(StainTag, T, SpawnPoint) || !*MemoryStainClass) return false;
+	++SkippedOccupied;
+	return false;
+}
 
-	// 스폰
-	AActor* NewStain = SpawnStainAtPoint(SpawnPoint);
-	if (!NewStain) return false;
+bool ANSSpawnDirector::FindFreePointByTag(FName Tag, FNSWorkTypeId Type, int32 PointIndex, FTransform& Out, uint8& OutStainMask, int32& OutZone)
+{
+	const FSpawnPointSet* Points = GetSpawnPoints(Tag);
+	if (!Points || Points->Num() == 0) { OutStainMask = 0; return false; }
 
-	// 태그로 타입 고르기 (예시)
-	EStainType Type = EStainType::None;
-	for (const FName& Tag : SpawnPoint->Tags)
+	const int32 N = Points->Num();
+	const int32 Start = (PointIndex == INDEX_NONE) ? SpawnRng.RandHelper(N) : PointIndex % N;
+	const int32 Probes = FMath::Min(N, MaxPointProbes);
+	for (int32 i = 0; i < Probes; ++i)
 	{
-		if (Tag == "Stain_Wall") { Type = EStainType::Wall; break; }
-		if (Tag == "Stain_Floor") { Type = EStainType::Floor;   break; }
-		if (Tag == "Stain_Object") { Type = EStainType::Object;   break; }
+		const int32 Idx = (Start + i) % N;
+		const FVector Pos = Points->Transforms[Idx].GetLocation();
+		if (!IsRelevantToPlayers(Pos) || IsPointOccupied(Pos, Type)) continue;
+
+		Out = Points->Transforms[Idx];
+		OutStainMask = Points->StainMasks[Idx];
+		OutZone = Points->Zones[Idx];
+		return true;
 	}
 
-	if (Type == EStainType::None)
+	// 전부 점유 → 쿼터 소모 없이 실패, 스케줄이 RetryDelaySec 뒤 재시도
+	++SkippedOccupied;
+	return false;
+}
+
+bool ANSSpawnDirector::IsPointOccupied(const FVector& Pos, FNSWorkTypeId Type) const
+{
+	if (Occupancy.AnyWithin(Pos, PointClearance, AllWorkTypeBits, ElapsedSec)) return true;
+
+	// 같은 타입끼리 간격 (얼룩 등)
+	const UNSWorkTypeDef* Def = GetWorkTypeDef(Type);
+	const float Spacing = Def ? FMath::Max(Def->MinSameTypeSpacing, PointClearance) : PointClearance;
+
+	// 시야 판정 대기 중인 후보도 자리 차지 (보통 몇 개뿐이라 선형)
+	for (const FPendingVisibility& P : PendingVisibility)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[SPAWN][Stain] no type with tag '%d'"), Type);
+		const float R = (P.Ev.Type == Type) ? Spacing : PointClearance;
+		if (FVector::DistSquared(P.Xform.GetLocation(), Pos) < FMath::Square(R)) return true;
 	}
 
+	return Spacing > PointClearance
+		&& Occupancy.AnyWithin(Pos, Spacing, WorkTypeBit(Type), ElapsedSec);
+}
+
+bool ANSSpawnDirector::CountsAsWork(FNSWorkTypeId Type) const
+{
+	const UNSWorkTypeDef* Def = GetWorkTypeDef(Type);
+	return !Def || Def->bCountsAsWork;
+}
 
-	// 타입→머티리얼 매핑 (에디터에서 채운 TMap 등)
-	UMaterialInterface* Mat = StainBaseMaterials.FindRef(Type);
-	if (!Mat) Mat = StainBaseMaterials[EStainType::Wall]; // 세이프 가드
+void ANSSpawnDirector::TrackNonWork(uint32 Id, const FVector& Pos, FNSWorkTypeId Type)
+{
+	// 만료된 승객 점유는 여기서 비움 → 해시 크기는 최근 OccupancyHoldSec 동안 스폰한 수로 한정
+	Occupancy.RemoveExpired(ElapsedSec);
+	Occupancy.Add(Id, Pos, Type, GetOccupancyExpireAt(Type));
+}
 
-	// 인터페이스 호출(서버)
-	if (NewStain->GetClass()->ImplementsInterface(UMopTarget::StaticClass()))
+void ANSSpawnDirector::TrackWork(AActor* Actor, const FVector& Pos, FNSWorkTypeId Type, int32 Zone)
+{
+	UntrackWork(Actor);   // 풀 재사용 액터면 이전 기록 정리
+	if (!CountsAsWork(Type))
 	{
-		IMopTarget::Execute_InitializeStain(NewStain, Type, Mat);
+		TrackNonWork(Actor->GetUniqueID(), Pos, Type);
+		NonWorkActors.RemoveAllSwap([](const TWeakObjectPtr<AActor>& A) { return !A.IsValid(); }, EAllowShrinking::No);
+		NonWorkActors.Add(Actor);
+		Actor->OnDestroyed.AddUniqueDynamic(this, &ANSSpawnDirector::HandleWorkDestroyed);
+		return;
 	}
 
-	Spawned.StainTotal++;
-	Alive.StainTotal++;
-	return true;
+	Work.Register(Actor, Type, ElapsedSec, Zone);
+	AdjustZoneLoad(Zone, +1);
+
+	Occupancy.Add(Actor->GetUniqueID(), Pos, Type, GetOccupancyExpireAt(Type));
+	PublishWorkStatus(Actor->GetUniqueID(), Type, Pos);
+
+	Actor->OnDestroyed.AddUniqueDynamic(this, &ANSSpawnDirector::HandleWorkDestroyed);
 }
 
-bool ANSSpawnDirector::TrySpawnRepair()
+void ANSSpawnDirector::TrackItem(const FNSWorkItemHandle& Item, const FVector& Pos, FNSWorkTypeId Type, int32 Zone)
 {
-	const FStageQuota& Q = GetQuotaFor(CurrentStage, EarlyQuota, PeakQuota, CleanupQuota);
-	if (Spawned.RepairTotal >= Q.RepairTotal) return false;
+	const uint32 Key = UNSWorkItemSubsystem::WorkKey(Item);
+	if (!CountsAsWork(Type))
+	{
+		TrackNonWork(Key, Pos, Type);
+		return;
+	}
 
-	FTransform T; if (!FindRandomPointByTag(RepairTag, T) || !*RepairClass) return false;
-	AActor* A = GetWorld()->SpawnActorDeferred<AActor>(RepairClass, T, this);
-	if (!A) return false;
-	if (auto* IA = Cast<AInteractiveActor>(A)) { IA->SetIsBroken(true); }
-	UGameplayStatics::FinishSpawningActor(A, T);
+	Work.RegisterKey(Key, Type, ElapsedSec, Zone);
+	AdjustZoneLoad(Zone, +1);
+	Occupancy.Add(Key, Pos, Type, GetOccupancyExpireAt(Type));
+	PublishWorkStatus(Key, Type, Pos);
+}
 
-	Spawned.RepairTotal++; Alive.RepairTotal++;
-	LogBatch(TEXT("Repair"), Spawned.RepairTotal);
-	return true;
+float ANSSpawnDirector::GetOccupancyExpireAt(FNSWorkTypeId Type) const
+{
+	const UNSWorkTypeDef* Def = GetWorkTypeDef(Type);
+	return (Def && Def->OccupancyHoldSec > 0.f) ? ElapsedSec + Def->OccupancyHoldSec : MAX_flt;
 }
 
-bool ANSSpawnDirector::FindRandomPointByTag(FName Tag, FTransform& Out) const
+void ANSSpawnDirector::UntrackWork(const AActor* Actor)
 {
-	TArray<AActor*> Points;
-	UGameplayStatics::GetAllActorsWithTag(GetWorld(), Tag, Points);
-	if (Points.Num() == 0) return false;
-	AActor* Pick = Points[FMath::RandHelper(Points.Num())];
-	Out = Pick->GetActorTransform();
-	return true;
+	if (const FNSWorkRecord* R = Work.Get(Work.Find(Actor)))
+	{
+		AdjustZoneLoad(R->Zone, -1);
+	}
+	Work.Unregister(Actor);
+	Occupancy.Remove(Actor->GetUniqueID());
+	if (ANSGameState* GS = GetStatusFeed()) GS->RemoveWorkStatus(Actor->GetUniqueID());
+}
+
+bool ANSSpawnDirector::FindRandomPointByTag(FName Tag, FTransform& Out)
+{
+	uint8 Unused = 0;
+	return FindPointByTag(Tag, INDEX_NONE, Out, Unused);
 }
 
 void ANSSpawnDirector::LogStageChange(ESpawnStage From, ESpawnStage To) const
@@ -286,147 +1458,253 @@ void ANSSpawnDirector::LogBatch(const FString& What, int32 Count) const
 	}
 }
 
-static EStainType GuessStainTypeFromTags(const AActor* P)
+void ANSSpawnDirector::OpenTelemetry()
 {
-	if (P->Tags.Contains(TEXT("Stain_Wall")))   return EStainType::Wall;
-	if (P->Tags.Contains(TEXT("Stain_Floor")))  return EStainType::Floor;
-	if (P->Tags.Contains(TEXT("Stain_Object"))) return EStainType::Object;
-	// 태그가 없으면 풀에서 랜덤
-	return EStainType::None;
+	// 데디서버는 GSDK가 지정한 로그 폴더(세션 종료 시 업로드됨), 없거나 로컬이면 Saved/Logs
+	FString Dir;
+#if UE_SERVER
+	Dir = UGSDKUtils::GetLogsDirectory();
+#endif
+	if (Dir.IsEmpty()) Dir = FPaths::ProjectLogDir();
+
+	const FString Path = Dir / FString::Printf(TEXT("NSSpawnTelemetry_%s.csv"), *FDateTime::Now().ToString());
+	Telemetry.Open(Path);
+	UE_LOG(LogTemp, Log, TEXT("[SPAWN] Telemetry -> %s"), *Path);
 }
 
-void ANSSpawnDirector::GetAllowedStainTypesFromTags(const AActor* SpawnPoint, TArray<EStainType>& OutTypes) const
+void ANSSpawnDirector::FlushTelemetry()
 {
-	OutTypes.Reset();
-	if (!SpawnPoint) return;
+	if (!Telemetry.IsOpen()) return;
 
-	const TArray<FName>& ArrayTags = SpawnPoint->Tags;
-
-	auto Has = [&](const FName& T) { return ArrayTags.Contains(T); };
+	TArray<FString> TypeNames;
+	for (const UNSWorkTypeDef* Def : ActiveWorkTypes)
+	{
+		TypeNames.Add(Def->GetTypeName().ToString());
+	}
 
-	if (Has(TAG_WALL))   OutTypes.Add(EStainType::Wall);
-	if (Has(TAG_FLOOR))  OutTypes.Add(EStainType::Floor);
-	if (Has(TAG_OBJECT)) OutTypes.Add(EStainType::Object);
+	const ANSGameState* GS = GetWorld()->GetGameState<ANSGameState>();
+	if (!Telemetry.Flush(GS ? GS->Day : 0, TypeNames, Work))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SPAWN] Telemetry write failed: %s"), *Telemetry.GetPath());
+	}
 }
 
-EStainType ANSSpawnDirector::PickTypeForPoint(const AActor* SpawnPoint) const
+uint8 ANSSpawnDirector::GetAllowedStainTypesFromTags(const AActor* SpawnPoint)
 {
-	TArray<EStainType> Allowed;
-	GetAllowedStainTypesFromTags(SpawnPoint, Allowed);
+	if (!SpawnPoint) return 0;
 
-	// 태그가 하나도 없으면 전 타입 허용
-	if (Allowed.Num() == 0)
-	{
-		Allowed = { EStainType::Wall, EStainType::Object, EStainType::Floor };
-	}
+	const TArray<FName>& ArrayTags = SpawnPoint->Tags;
+
+	uint8 Mask = 0;
+	if (ArrayTags.Contains(TAG_WALL))   Mask |= StainBit(EStainType::Wall);
+	if (ArrayTags.Contains(TAG_FLOOR))  Mask |= StainBit(EStainType::Floor);
+	if (ArrayTags.Contains(TAG_OBJECT)) Mask |= StainBit(EStainType::Object);
+	return Mask;
+}
 
-	const int32 Idx = FMath::RandRange(0, Allowed.Num() - 1);
-	return Allowed[Idx];
+EStainType ANSSpawnDirector::PickTypeForPoint(uint8 AllowedMask)
+{
+	return FNSSpawnSchedule::PickStainType(AllowedMask, SpawnRng);
 }
 
-AActor* ANSSpawnDirector::SpawnStainAtPoint(AActor* SpawnPoint)
+AActor* ANSSpawnDirector::SpawnStainAtPoint(UClass* Cls, const FTransform& Xform, EStainType Type)
 {
-	if (!HasAuthority() || !MemoryStainClass || !SpawnPoint) {
-		UE_LOG(LogTemp, Error, TEXT("[SPAWN][Stain] invalid args (Auth=%d, Class=%d, Point=%s)"),
-			HasAuthority() ? 1 : 0, *MemoryStainClass ? 1 : 0, *GetNameSafe(SpawnPoint));
+	if (!HasAuthority() || !Cls) {
+		UE_LOG(LogTemp, Error, TEXT("[SPAWN][Stain] invalid args (Auth=%d, Class=%d)"),
+			HasAuthority() ? 1 : 0, Cls ? 1 : 0);
 		return nullptr;
 	}
 
-	const EStainType Type = PickTypeForPoint(SpawnPoint);
-
-	// 스폰 트랜스폼(필요하면 타입별로 정렬)
-	FTransform Xform = SpawnPoint->GetActorTransform();
-
-	AActor* Stain = GetWorld()->SpawnActorDeferred<AActor>(MemoryStainClass, Xform, this, nullptr, ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButDontSpawnIfColliding);
+	// 풀에서 꺼내거나(hit) 새로 스폰(miss)
+	// 점유/간격은 Occupancy에서 이미 걸렀으므로 충돌 조정 쿼리 없이 그 자리에 둠
+	AActor* Stain = GetWorkPool()->Acquire(Cls, Xform, this, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
 	if (!Stain) return nullptr;
 
-	UGameplayStatics::FinishSpawningActor(Stain, Xform);
-
-	// 타입에 맞는 기본 머티리얼
-	UMaterialInterface* BaseMat = StainBaseMaterials.FindRef(Type);
-
-	IMopTarget::Execute_InitializeStain(Stain, Type, BaseMat);
-
-	Stain->OnDestroyed.AddDynamic(this, &ANSSpawnDirector::HandleStainDestroyed);
+	IMopTarget::InitializeStainOn(Stain, Type, GetStainBaseMaterial(Type));
 
 	return Stain;
 }
 
+UMaterialInterface* ANSSpawnDirector::GetStainBaseMaterial(EStainType Type) const
+{
+	// 타입에 맞는 기본 머티리얼
+	UMaterialInterface* BaseMat = StainBaseMaterials.FindRef(Type).Get();
+	if (!BaseMat) BaseMat = StainBaseMaterials.FindRef(EStainType::Wall).Get(); // 세이프 가드
+	return BaseMat;
+}
+
 int32 ANSSpawnDirector::GetAliveWorkCount() const
 {
-	return Alive.RepairTotal + Alive.StainTotal + Alive.ShardTotal;
+	int32 Alive = 0;
+	for (int32 T = 0; T < ActiveWorkTypes.Num(); ++T)
+	{
+		if (ActiveWorkTypes[T]->bCountsAsWork) Alive += Work.Count(FNSWorkTypeId(T));
+	}
+	return Alive;
+}
+
+void ANSSpawnDirector::LogLeftoverWork() const
+{
+	int32 Num[MaxWorkTypes] = {};
+	float SumAge[MaxWorkTypes] = {};
+	float MaxAge[MaxWorkTypes] = {};
+	Work.ForEach([&](const FNSWorkRecord& R)
+		{
+			const int32 T = int32(R.Type);
+			const float Age = ElapsedSec - R.SpawnedAt;
+			++Num[T]; SumAge[T] += Age; MaxAge[T] = FMath::Max(MaxAge[T], Age);
+		});
+
+	for (int32 T = 0; T < ActiveWorkTypes.Num(); ++T)
+	{
+		if (Num[T] == 0 || !ActiveWorkTypes[T]->bCountsAsWork) continue;
+		UE_LOG(LogTemp, Log, TEXT("[SPAWN] Leftover %s=%d avgAge=%.0fs maxAge=%.0fs"),
+			*ActiveWorkTypes[T]->GetTypeName().ToString(), Num[T], SumAge[T] / Num[T], MaxAge[T]);
+	}
 }
 
 void ANSSpawnDirector::DeactivateAllWork()
 {
 	if (!HasAuthority()) return;
 
-	// 수리: 모두 정상 상태로 되돌리기
-	for (auto& W : RepairPool)
+	// 수리: 고장 목록만 정상 상태로 되돌리기 (SetIsBroken이 유휴 목록으로 옮김)
+	while (RepairBroken.Num() > 0)
 	{
-		if (AInteractiveActor* R = W.Get())
-		{
-			if (R->IsBroken())
-			{
-				R->SetIsBroken(false);
-			}
-		}
+		const int32 Pos = RepairBroken.Num() - 1;
+		AInteractiveActor* R = RepairPool[RepairBroken[Pos]].Get();
+		const int32 Before = RepairBroken.Num();
+		if (R) R->SetIsBroken(false);
+		if (RepairBroken.Num() == Before) DropRepairSlot(RepairBroken, Pos);
 	}
 
-	// 얼룩: 현재 존재하는 얼룩 액터 전부 제거
-	if (*MemoryStainClass)
+	// 포인트 스폰 업무(얼룩/샤드 등): 레지스트리에 있는 것만 Destroy 대신 풀로 반납 (OnDestroyed가 안 불리므로 여기서 해제)
+	UNSWorkPoolSubsystem* Pool = GetWorkPool();
+	UNSWorkItemSubsystem* Items = GetWorkItems();
+	TArray<FNSWorkRecord> Released;
+	int32 ItemsRemoved = 0;
+	for (int32 T = 0; T < ActiveWorkTypes.Num(); ++T)
 	{
-		TArray<AActor*> Stains;
-		UGameplayStatics::GetAllActorsOfClass(GetWorld(), MemoryStainClass, Stains);
-		for (AActor* A : Stains)
+		const UNSWorkTypeDef* Def = ActiveWorkTypes[T];
+		if (Def->SpawnMode == EWorkSpawnMode::RepairPool) continue;
+		if (!Def->bCountsAsWork)
+		{
+			// 레지스트리에 없는 타입(승객): 점유/항목만 비움. 액터는 아래에서 한꺼번에 반납
+			Occupancy.RemoveType(FNSWorkTypeId(T));
+			if (Def->bActorless && Items) Items->RemoveType(FNSWorkTypeId(T));
+			continue;
+		}
+		if (Def->bActorless && Items)
 		{
-			if (A) { A->Destroy(); } // Destroy될 때 HandleStainDestroyed에서 Alive.StainTotal--
+			// 항목 제거 → HandleWorkItemResolved가 레지스트리/점유 해제 (라운드 밖이라 완료로 안 셈)
+			ItemsRemoved += Work.Count(FNSWorkTypeId(T));
+			Items->RemoveType(FNSWorkTypeId(T));
 		}
+		Work.TakeType(FNSWorkTypeId(T), Released);
+		Occupancy.RemoveType(FNSWorkTypeId(T));
 	}
-
-	// 샤드 제거 추가
-	if (*MemoryShardClass)
+	ANSGameState* GS = GetStatusFeed();
+	for (const FNSWorkRecord& R : Released)
 	{
-		TArray<AActor*> Shards;
-		UGameplayStatics::GetAllActorsOfClass(GetWorld(), MemoryShardClass, Shards);
-		for (AActor* A : Shards)
+		AdjustZoneLoad(R.Zone, -1);
+		if (GS) GS->RemoveWorkStatus(R.ActorId);
+		if (AActor* A = R.Actor.Get())
 		{
-			if (A) { A->Destroy(); } // Destroy 시 HandleShardDestroyed에서 Alive.ShardTotal--
+			if (Pool) Pool->Release(A);
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("[SPAWN] DeactivateAllWork: repairs reset, stains & shards destroyed"));
+	int32 NonWorkReleased = 0;
+	for (const TWeakObjectPtr<AActor>& Weak : NonWorkActors)
+	{
+		AActor* A = Weak.Get();
+		if (!A || !Pool) continue;
+		A->OnDestroyed.RemoveDynamic(this, &ANSSpawnDirector::HandleWorkDestroyed);
+		Pool->Release(A);
+		++NonWorkReleased;
+	}
+	NonWorkActors.Reset();
+
+	UE_LOG(LogTemp, Log, TEXT("[SPAWN] DeactivateAllWork: repairs reset, %d work actors returned to pool, %d items removed, %d non-work actors returned"),
+		Released.Num(), ItemsRemoved, NonWorkReleased);
 }
 
-// 얼룩 파괴 시점에 Alive 카운트 조정
-void ANSSpawnDirector::HandleStainDestroyed(AActor* DestroyedActor)
+void ANSSpawnDirector::HandleWorkDestroyed(AActor* DestroyedActor)
 {
-	Alive.StainTotal = FMath::Max(0, Alive.StainTotal - 1);
+	if (!DestroyedActor) return;
+
+	// 라운드 중 파괴 = 완료 (청소/수집). 타입 훅 호출
+	const FNSWorkRecord* R = bActive ? Work.Get(Work.Find(DestroyedActor)) : nullptr;
+	if (const UNSWorkTypeDef* Def = R ? GetWorkTypeDef(R->Type) : nullptr)
+	{
+		Telemetry.RecordResolved(R->Type, ElapsedSec - R->SpawnedAt);
+		Def->OnWorkCompleted(DestroyedActor, this);
+	}
+	UntrackWork(DestroyedActor);
+	UE_LOG(LogTemp, Verbose, TEXT("[SPAWN] WorkDestroyed %s Alive=%d"), *DestroyedActor->GetName(), GetAliveWorkCount());
 }
 
-bool ANSSpawnDirector::TrySpawnShard()
+void ANSSpawnDirector::HandleWorkItemResolved(FNSWorkItemHandle Item, FNSWorkTypeId Type, AActor* CompletedActor)
 {
-	const FStageQuota& Q = GetQuotaFor(CurrentStage, EarlyQuota, PeakQuota, CleanupQuota);
-	if (Spawned.ShardTotal >= Q.ShardTotal) return false;
+	const uint32 Key = UNSWorkItemSubsystem::WorkKey(Item);
+	const FNSWorkRecord* R = Work.Get(Work.FindKey(Key));
+	if (!R)
+	{
+		Occupancy.Remove(Key);   // 업무로 세지 않는 타입은 점유만 있음
+		return;
+	}
 
-	FTransform T;
-	if (!FindRandomPointByTag(ShardTag, T) || !*MemoryShardClass) return false;
+	// 라운드 중 상호작용 액터 파괴 = 완료. 정리(Remove)는 해제만
+	const UNSWorkTypeDef* Def = GetWorkTypeDef(Type);
+	if (bActive && CompletedActor && Def)
+	{
+		Telemetry.RecordResolved(Type, ElapsedSec - R->SpawnedAt);
+		Def->OnWorkCompleted(CompletedActor, this);
+	}
+	AdjustZoneLoad(R->Zone, -1);
+	Work.UnregisterKey(Key);
+	Occupancy.Remove(Key);
+	if (ANSGameState* GS = GetStatusFeed()) GS->RemoveWorkStatus(Key);
+	UE_LOG(LogTemp, Verbose, TEXT("[SPAWN] WorkItemResolved slot=%d completed=%d Alive=%d"), Item.Slot, CompletedActor ? 1 : 0, GetAliveWorkCount());
+}
 
-	AActor* A = GetWorld()->SpawnActorDeferred<AActor>(MemoryShardClass, T, this);
-	if (!A) return false;
-	UGameplayStatics::FinishSpawningActor(A, T);
+ANSGameState* ANSSpawnDirector::GetStatusFeed() const
+{
+	return GetWorld() ? GetWorld()->GetGameState<ANSGameState>() : nullptr;
+}
+
+void ANSSpawnDirector::PublishWorkStatus(uint32 Id, FNSWorkTypeId Type, const FVector& Location) const
+{
+	if (!CountsAsWork(Type)) return;
+	if (ANSGameState* GS = GetStatusFeed()) GS->AddWorkStatus(Id, Type, Location);
+}
 
-	A->OnDestroyed.AddDynamic(this, &ANSSpawnDirector::HandleShardDestroyed);
+void ANSSpawnDirector::RefreshWorkStatus()
+{
+	if (!IsServerActive()) return;
+	ANSGameState* GS = GetStatusFeed();
+	if (!GS) return;
 
-	Spawned.ShardTotal++;
-	Alive.ShardTotal++; 
-	LogBatch(TEXT("Shard"), Spawned.ShardTotal);
-	return true;
+	// 진행도만 폴링. 양자화 값이 바뀐 항목만 더티가 되어 델타로 나감
+	Work.ForEach([this, GS](const FNSWorkRecord& R)
+		{
+			GS->SetWorkStatusProgress(R.ActorId, ReadWorkProgress(R));
+		});
 }
 
-void ANSSpawnDirector::HandleShardDestroyed(AActor* DestroyedActor)
+float ANSSpawnDirector::ReadWorkProgress(const FNSWorkRecord& R) const
 {
-	Alive.ShardTotal = FMath::Max(0, Alive.ShardTotal - 1);
-	UE_LOG(LogTemp, Verbose, TEXT("[SPAWN] ShardDestroyed %s Alive=%d"),
-		*GetNameSafe(DestroyedActor), Alive.ShardTotal);
-}
\ No newline at end of file
+	if (UNSWorkItemSubsystem::IsWorkKey(R.ActorId))
+	{
+		const UNSWorkItemSubsystem* Items = GetWorkItems();
+		return Items ? Items->GetProgressByKey(R.ActorId) : 0.f;
+	}
+	if (const AInteractiveActor* Repair = Cast<AInteractiveActor>(R.Actor.Get()))
+	{
+		return Repair->RepairProgress;
+	}
+	if (const AMemoryStain* Stain = Cast<AMemoryStain>(R.Actor.Get()))
+	{
+		return Stain->GetMopAlpha();
+	}
+	return 0.f;
+}
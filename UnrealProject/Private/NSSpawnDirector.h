@@ -4,9 +4,17 @@
 
 #include "CoreMinimal.h"
 #include "NSTypes.h"
+#include "NSSpawnSchedule.h"
+#include "NSSpatialHash.h"
+#include "NSWorkRegistry.h"
+#include "NSSpawnPacing.h"
+#include "NSSpawnTelemetry.h"
 #include "GameFramework/Actor.h"
+#include "Engine/StreamableManager.h"
+#include "WorldCollision.h"
 #include "NSSpawnDirector.generated.h"
 
+// WorkTypes가 비어 있을 때 기본 4종(승객/얼룩/수리/파편)을 만드는 예전 설정
 USTRUCT(BlueprintType)
 struct FStageQuota
 {
@@ -27,68 +35,158 @@ struct FSpawnCooldown
 	UPROPERTY(EditAnywhere) float Shard = 6.f;
 };
 
+// 태그 하나에 해당하는 스폰 포인트 묶음(BeginSpawnLoop에서 한 번 컴파일)
+struct FSpawnPointSet
+{
+	TArray<FTransform> Transforms;
+	TArray<uint8> StainMasks;     // 포인트별 허용 EStainType 비트마스크
+
+	// 점수화용 SoA (위치 성분/구역 인덱스)
+	TArray<float> X, Y, Z;
+	TArray<int32> Zones;
+
+	int32 Num() const { return Transforms.Num(); }
+	void Reset() { Transforms.Reset(); StainMasks.Reset(); X.Reset(); Y.Reset(); Z.Reset(); Zones.Reset(); }
+	void Add(const FTransform& Xform, uint8 StainMask, int32 Zone);
+	void Append(const FSpawnPointSet& Other);
+	// 위치(X→Y→Z) 순으로 정렬. 액터 순회/베이크 순서와 무관하게 같은 포인트 집합 = 같은 인덱스
+	void SortByLocation();
+};
+
+// 플레이어 위치/구역 부하 기반 포인트 가중치
+USTRUCT(BlueprintType)
+struct FNSPointScoringConfig
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere) bool bEnabled = true;
+	// 플레이어 이 반경 안의 포인트는 NearPlayerWeight만큼만 (업무는 플레이어 밖에서 생기도록). 승객은 제외
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0")) float PreferOutsideRadius = 800.f;
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0", ClampMax = "1")) float NearPlayerWeight = 0.15f;
+	// 구역 가중치 = 1 / (1 + ZoneBalance * 구역의 살아 있는 업무 수)
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0")) float ZoneBalance = 1.f;
+	// 포인트 수가 이보다 적으면 단일 스레드
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "1")) int32 ParallelMinPoints = 1024;
+};
+
+class UNSSpawnPointAsset;
+class UNSWorkTypeDef;
+class UNSWorkItemSubsystem;
+class ANSGameState;
+struct FNSWorkItemHandle;
+
 UCLASS()
 class ANSSpawnDirector : public AActor
 {
 	GENERATED_BODY()
+	friend class UNSBakeSpawnPointsCommandlet;
 	
 public:	
 	ANSSpawnDirector();
 
-	//     ȣ
+	// 라운드 시작 시 서버에서 호출
 	UFUNCTION() void BeginSpawnLoop(float InRoundLengthSec);
-	//  / 
+	// 라운드 종료/엔딩 시
 	UFUNCTION() void EndSpawnLoop();
 
 	UFUNCTION(BlueprintCallable, Category = "Spawn|Admin")
 	int32 GetAliveWorkCount() const;
 
-	//   Ȱȭ:   +  
+	// 살아 있는 업무 전체 (타입/스폰 시각). 평가/텔레메트리용
+	const FNSWorkRegistry& GetWorkRegistry() const { return Work; }
+	float GetElapsedSec() const { return ElapsedSec; }
+	// 남은 업무 타입별 개수와 평균/최대 경과 시간 로그 (EvaluateDay에서)
+	void LogLeftoverWork() const;
+
+	// 모든 업무 비활성화: 고장 복구 + 얼룩 제거
 	UFUNCTION(BlueprintCallable, Category = "Spawn|Admin")
 	void DeactivateAllWork();
 
-	//  ( GS)
+	// 현재 스테이지(복제는 GS에서)
 	ESpawnStage GetStage() const { return CurrentStage; }
 
+	// 현재 설정 + 포인트 테이블로 스케줄 입력 구성 (테스트/벤치에서 Build(Params, Seed)로 재현)
+	FNSSpawnScheduleParams MakeScheduleParams();
+	// 쿼터/쿨다운/스테이지만 채움 (월드 불필요: 시뮬레이터는 CDO에서 호출)
+	void FillScheduleConfig(FNSSpawnScheduleParams& P) const;
+	int32 GetMaxSimultaneousRepairs() const { return MaxSimultaneousRepairs; }
+
+	// 업무 타입 정의 (인덱스 = 타입 ID). WorkTypes가 비었으면 예전 필드로 기본 4종을 만들어 채움. CDO에서도 호출 가능
+	void MakeWorkTypes(TArray<TObjectPtr<UNSWorkTypeDef>>& Out) const;
+	// 런타임(BeginPlay 후) 타입 정의. 범위 밖이면 nullptr
+	const UNSWorkTypeDef* GetWorkTypeDef(FNSWorkTypeId Type) const;
+	int32 GetNumWorkTypes() const { return ActiveWorkTypes.Num(); }
+	float GetRetryDelaySec() const { return RetryDelaySec; }
+	const FNSSpawnSchedule& GetSchedule() const { return Schedule; }
+
+	// 스폰 클래스/머티리얼 비동기 로드 (Waiting/Starting 단계에서 GameMode가 호출). 완료 시 액터 풀 프리웜
+	void PreloadSpawnAssets();
+	bool AreSpawnAssetsLoaded() const { return bSpawnAssetsReady; }
+	// 미리 로드할 소프트 경로 목록 (CDO에서도 호출 가능: 클라 프리패치용)
+	void GatherPreloadPaths(TArray<FSoftObjectPath>& Out) const;
+
+	// 맵 로드 메모리를 줄이려고 전부 소프트 참조. 실제 사용 전 PreloadSpawnAssets로 상주시킴
 	UPROPERTY(EditAnywhere, Category = "Classes")
-	TSubclassOf<AActor> StainClass;
+	TSoftClassPtr<AActor> StainClass;
 	UPROPERTY(EditAnywhere, Category = "Stain")
-	TMap<EStainType, UMaterialInterface*> StainMaterials;
+	TMap<EStainType, TSoftObjectPtr<UMaterialInterface>> StainMaterials;
 	UPROPERTY(EditAnywhere, Category = "Stain")
 	TArray<EStainType> StainTypePool{ EStainType::Wall, EStainType::Object, EStainType::Floor };
 	UPROPERTY(EditDefaultsOnly, Category = "Stain")
-	TSubclassOf<AActor> MemoryStainClass;
+	TSoftClassPtr<AActor> MemoryStainClass;
 	UPROPERTY(EditDefaultsOnly, Category = "Stain")
-	TMap<EStainType, UMaterialInterface*> StainBaseMaterials;
+	TMap<EStainType, TSoftObjectPtr<UMaterialInterface>> StainBaseMaterials;
 	UPROPERTY(EditAnywhere, Category = "Classes")
-	TSubclassOf<AActor> MemoryShardClass;
+	TSoftClassPtr<AActor> MemoryShardClass;
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+	// 스폰 큐가 찼을 때만 켜짐: 프레임당 SpawnBudgetMs 안에서 처리
 	virtual void Tick(float DeltaTime) override;
 
-	//  
+	// 서버 전용
 	bool IsServerActive() const { return HasAuthority() && bActive; }
 
-	void GetAllowedStainTypesFromTags(const AActor* SpawnPoint, TArray<EStainType>& OutTypes) const;
+	// 포인트 태그(Stain_Wall/Floor/Object) → 허용 타입 비트마스크 (테이블 빌드 시 1회)
+	static uint8 GetAllowedStainTypesFromTags(const AActor* SpawnPoint);
 
-	EStainType PickTypeForPoint(const AActor* SpawnPoint) const;
+	EStainType PickTypeForPoint(uint8 AllowedMask);
 
-	AActor* SpawnStainAtPoint(AActor* SpawnPoint);
+	AActor* SpawnStainAtPoint(UClass* Cls, const FTransform& Xform, EStainType Type);
+	UMaterialInterface* GetStainBaseMaterial(EStainType Type) const;
 
 private:
-	UPROPERTY(EditAnywhere, Category = "Classes") TSubclassOf<AActor> PassengerClass;
+	UPROPERTY(EditAnywhere, Category = "Classes") TSoftClassPtr<AActor> PassengerClass;
 	UPROPERTY(EditAnywhere, Category = "Classes") TSubclassOf<AActor> InteractableClass;
-	UPROPERTY(EditAnywhere, Category = "Classes") TSubclassOf<AActor> RepairClass;
 
-	UFUNCTION()
-	void HandleStainDestroyed(AActor* DestroyedActor);
+	// 업무 타입 레지스트리. 비워 두면 아래 예전 쿼터/쿨다운/태그/클래스 필드로 기본 4종을 만든다
+	UPROPERTY(EditAnywhere, Category = "Spawn|Work Types")
+	TArray<TObjectPtr<UNSWorkTypeDef>> WorkTypes;
+
+	// BeginPlay에서 확정한 타입 목록 + 타입 ID로 인덱싱하는 카운터 배열
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UNSWorkTypeDef>> ActiveWorkTypes;
+	TArray<int32> SpawnedCount;    // 라운드 시작부터 스폰 수 (스테이지 쿼터와 비교)
+	TArray<int32> PendingCount;    // 시야 판정 대기 수
+	int32 RepairTypeId = INDEX_NONE;   // RepairPool 모드 타입
 
+	void ResolveWorkTypes();
+	// bScaled = 페이싱(QuotaScale)으로 줄인 쿼터 기준. false면 스테이지 원래 쿼터
+	bool IsQuotaFull(FNSWorkTypeId Type, bool bScaled = true) const;
+
+	// 디렉터가 내보낸 업무 액터가 외부에서 파괴되거나 풀 CompleteWork로 완료됨(청소 완료 등) → 레지스트리/점유 해제
 	UFUNCTION()
-	void HandleShardDestroyed(AActor* DestroyedActor);
+	void HandleWorkDestroyed(AActor* DestroyedActor);
+	FDelegateHandle WorkCompletedHandle;
+
+	// 액터 없는 항목(bActorless 타입)이 완료/정리됨. CompletedActor는 상호작용 액터가 파괴됐을 때만
+	void HandleWorkItemResolved(FNSWorkItemHandle Item, FNSWorkTypeId Type, AActor* CompletedActor);
+	FDelegateHandle ItemResolvedHandle;
+	UNSWorkItemSubsystem* GetWorkItems() const;
 
-	// ʿ ġ TargetPoint/Empty Actor  Tag ġ ׷ 
+	// 맵에 배치한 TargetPoint/Empty Actor 등에 Tag로 위치 그룹 지정
 	UPROPERTY(EditAnywhere, Category = "Spawn|Tags")
 	FName PassengerTag = TEXT("Spawn_Passenger");
 	UPROPERTY(EditAnywhere, Category = "Spawn|Tags")
@@ -103,14 +201,38 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Repair Pool")
 	int32 MaxSimultaneousRepairs = 2;
 
+	// 맵 로드 시 액터 풀에 미리 만들어 둘 개수 (피크 쿼터 기준)
+	UPROPERTY(EditAnywhere, Category = "Spawn|Pool")
+	int32 PrewarmStains = 10;
+	UPROPERTY(EditAnywhere, Category = "Spawn|Pool")
+	int32 PrewarmShards = 3;
+	UPROPERTY(EditAnywhere, Category = "Spawn|Pool")
+	int32 PrewarmPassengers = 18;
+
+	class UNSWorkPoolSubsystem* GetWorkPool() const;
+	void PrewarmWorkPool();
+
+	// 로드 핸들을 들고 있는 동안 클래스/머티리얼이 상주
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+	bool bSpawnAssetsReady = false;
+	void OnSpawnAssetsLoaded();
+
 	UPROPERTY()
 	TArray<TWeakObjectPtr<class AInteractiveActor>> RepairPool;
 
+	// RepairPool 인덱스를 유휴/고장 목록으로 나눠 들고 있음 (스왑 제거, 풀 전체 순회 없음)
+	TArray<int32> RepairIdle;
+	TArray<int32> RepairBroken;
+	TArray<int32> RepairListPos;   // 풀 인덱스 → 현재 속한 목록 안의 위치
+
 	UFUNCTION()
 	void OnRepairCompleted(class AInteractiveActor* Who);
+	void OnRepairBrokenChanged(class AInteractiveActor* Who, bool bBroken, int32 PoolIndex);
+	void MoveRepairSlot(int32 PoolIndex, bool bBroken);
+	void DropRepairSlot(TArray<int32>& List, int32 Pos);
 	void BuildRepairPool();
-	bool ActivateRandomRepair();
-	int32 CountActiveRepairs() const;
+	bool ActivateRandomRepair(int32 Pick, FNSWorkTypeId Type);
+	int32 CountActiveRepairs() const { return RepairBroken.Num(); }
 
 	UPROPERTY(EditAnywhere, Category = "Spawn|Stage")
 	float EarlyEndSec = 120.f;
@@ -129,28 +251,217 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Spawn|Pacing")
 	FSpawnCooldown CooldownSec;
 
-	//  
+	// 0이면 매일 새 시드. 로그의 seed를 넣으면(-SpawnSeed= 도 가능) 그 날을 그대로 재현
+	UPROPERTY(EditAnywhere, Category = "Spawn|Schedule")
+	int32 ScheduleSeed = 0;
+
+	// 실행 실패한 이벤트(포인트 없음/수리 최대치 등) 재시도 간격
+	UPROPERTY(EditAnywhere, Category = "Spawn|Schedule")
+	float RetryDelaySec = 1.f;
+
+	// 서버 프레임 시간/인원/미해결 업무로 쿨다운·쿼터를 런타임 조절
+	UPROPERTY(EditAnywhere, Category = "Spawn|Pacing")
+	FNSSpawnPacingConfig PacingConfig;
+
+	// 활성 얼룩끼리 최소 간격(cm). 기본 4종용 (정의 에셋은 MinSameTypeSpacing)
+	UPROPERTY(EditAnywhere, Category = "Spawn|Spacing", meta = (ClampMin = "0"))
+	float StainMinSpacing = 150.f;
+	// 이 반경 안에 살아 있는 업무 액터(타입 무관)가 있으면 포인트 점유로 보고 건너뜀
+	UPROPERTY(EditAnywhere, Category = "Spawn|Spacing", meta = (ClampMin = "0"))
+	float PointClearance = 60.f;
+	// 승객은 스폰 후 자리를 뜨므로 이 시간 뒤엔 점유 해제. 기본 4종용 (정의 에셋은 OccupancyHoldSec)
+	UPROPERTY(EditAnywhere, Category = "Spawn|Spacing", meta = (ClampMin = "0"))
+	float PassengerHoldSec = 8.f;
+	// 점유된 포인트면 다음 인덱스로 최대 몇 개까지 넘겨볼지
+	UPROPERTY(EditAnywhere, Category = "Spawn|Spacing", meta = (ClampMin = "1"))
+	int32 MaxPointProbes = 8;
+
+	// 프레임당 스폰 처리 시간 예산(ms). 최소 1건은 매 프레임 처리
+	UPROPERTY(EditAnywhere, Category = "Spawn|Budget", meta = (ClampMin = "0.1"))
+	float SpawnBudgetMs = 1.f;
+
+	// 켜면 어느 플레이어 카메라에서든 보이는 포인트에는 얼룩/파편을 스폰하지 않음 (비동기 트레이스, 한 프레임 뒤 판정)
+	UPROPERTY(EditAnywhere, Category = "Spawn|Visibility")
+	bool bHideSpawnsFromPlayers = false;
+	UPROPERTY(EditAnywhere, Category = "Spawn|Visibility", meta = (EditCondition = "bHideSpawnsFromPlayers"))
+	TEnumAsByte<ECollisionChannel> VisibilityChannel = ECC_Visibility;
+	// 이보다 먼 카메라는 못 보는 것으로 간주(트레이스 생략). 0이면 제한 없음
+	UPROPERTY(EditAnywhere, Category = "Spawn|Visibility", meta = (EditCondition = "bHideSpawnsFromPlayers", ClampMin = "0"))
+	float VisibilityMaxDistance = 5000.f;
+	// 표면에 붙는 얼룩이 자기 표면에 막히지 않게 트레이스 끝을 카메라 쪽으로 당기는 거리(cm)
+	UPROPERTY(EditAnywhere, Category = "Spawn|Visibility", meta = (EditCondition = "bHideSpawnsFromPlayers", ClampMin = "0"))
+	float VisibilityEndPullback = 20.f;
+
+	// 라운드 종료마다 시도/성공/실패 사유, 스폰 비용, 생존 업무 추이, 완료 시간, 서버 복제 부하(프레임ms/송신 KB/s)를 세션 CSV에 덧붙임
+	// (데디서버는 GSDK 로그 폴더, 그 외엔 Saved/Logs)
+	UPROPERTY(EditAnywhere, Category = "Spawn|Telemetry")
+	bool bWriteTelemetry = true;
+	// 살아 있는 업무 수 샘플 간격(초)
+	UPROPERTY(EditAnywhere, Category = "Spawn|Telemetry", meta = (EditCondition = "bWriteTelemetry", ClampMin = "0.5"))
+	float TelemetrySampleSec = 5.f;
+
+	FNSSpawnTelemetry Telemetry;
+	float NextTelemetrySampleSec = 0.f;
+
+	// 게임 스테이트 업무 현황(HUD/미니맵) 진행도 갱신 간격(초). 추가/해제는 즉시 반영
+	UPROPERTY(EditAnywhere, Category = "Spawn|Status", meta = (ClampMin = "0.05"))
+	float WorkStatusSampleSec = 0.25f;
+	FTimerHandle WorkStatusHandle;
+
+	ANSGameState* GetStatusFeed() const;
+	// 업무로 세는 타입(bCountsAsWork)만 피드에 올림. 승객 같은 타입은 클라에 내려가지 않음
+	void PublishWorkStatus(uint32 Id, FNSWorkTypeId Type, const FVector& Location) const;
+	void RefreshWorkStatus();
+	float ReadWorkProgress(const FNSWorkRecord& R) const;
+
+	void OpenTelemetry();
+	void FlushTelemetry();
+	void RecordSpawnFail(FNSWorkTypeId Type, ESpawnFailReason Reason) { Telemetry.RecordFail(Type, CurrentStage, Reason); }
+
+	// 내부 상태
 	bool  bActive = false;
 	float ElapsedSec = 0.f;
+	float DayStartSec = 0.f;     // 월드 시간 기준 라운드 시작
+	float NextWakeSec = 0.f;     // 예약된 깨움 시각(ElapsedSec 기준)
+	FTimerHandle WakeHandle;
+
+	// 스케줄 시계: 이벤트 시각은 이 시계 기준, Pacing.Rate 속도로 흐름 (Rate<1이면 쿨다운이 늘어난 효과)
+	float ScheduleClock = 0.f;
+	float ClockSyncSec = 0.f;    // ScheduleClock을 마지막으로 맞춘 ElapsedSec
+	float NextWakeClock = 0.f;   // 이벤트 때문에 깨는 경우 그 이벤트의 스케줄 시각
+	FNSSpawnPacing Pacing;
+	FTimerHandle PacingHandle;
+
+	void SyncClocks();
+	void SamplePacing();
+	float GetFrameBudgetMs() const;
 	ESpawnStage CurrentStage = ESpawnStage::Inactive;
 
-	FStageQuota Spawned;
-	FStageQuota Alive;
-
-	//  ŸԺ    ð
-	float NextPassengerTime = 0.f, NextStainTime = 0.f, NextRepairTime = 0.f, NextShardTime = 0.f;
-
-	// 
+	FNSWorkRegistry Work;   // 살아 있는 업무 전부 (수리 포함)
+
+	// 오늘 스케줄 + 런타임 보정용 난수(같은 시드)
+	FNSSpawnSchedule Schedule;
+	FRandomStream SpawnRng;
+
+	// 살아 있는 얼룩/샤드/승객 위치 (포인트 점유/간격 판정용)
+	FNSSpatialHash Occupancy;
+	int32 SkippedOccupied = 0;
+
+	bool IsPointOccupied(const FVector& Pos, FNSWorkTypeId Type) const;
+	// 스폰 성공한 업무를 레지스트리 + 점유 해시에 등록
+	void TrackWork(AActor* Actor, const FVector& Pos, FNSWorkTypeId Type, int32 Zone = INDEX_NONE);
+	void UntrackWork(const AActor* Actor);
+	// 액터 없는 항목을 같은 레지스트리/점유 해시에 등록 (키 = UNSWorkItemSubsystem::WorkKey)
+	void TrackItem(const FNSWorkItemHandle& Item, const FVector& Pos, FNSWorkTypeId Type, int32 Zone);
+	float GetOccupancyExpireAt(FNSWorkTypeId Type) const;
+	// 업무로 세지 않는 타입(승객): 레지스트리/구역 부하/상태 피드 없이 점유만 (OccupancyHoldSec 뒤 만료)
+	bool CountsAsWork(FNSWorkTypeId Type) const;
+	void TrackNonWork(uint32 Id, const FVector& Pos, FNSWorkTypeId Type);
+	// 그 액터들. 하루 끝(DeactivateAllWork)에 풀로 반납
+	TArray<TWeakObjectPtr<AActor>> NonWorkActors;
+
+	// 구역: 포인트의 Zone_* 태그, 없으면 소속 레벨(WP 셀/서브레벨). 이름→인덱스는 세션 내내 유지
+	TMap<FName, int32> ZoneIndexByName;
+	TArray<int32> ZoneLoad;        // 구역별 살아 있는 업무 수
+	int32 GetZoneIndex(FName ZoneName);
+	void AdjustZoneLoad(int32 Zone, int32 Delta);
+
+	UPROPERTY(EditAnywhere, Category = "Spawn|Scoring")
+	FNSPointScoringConfig PointScoring;
+
+	// 점수 → 누적 가중치 (재사용 버퍼)
+	TArray<float> ScoreScratch;
+
+	// 후보 전체를 플레이어 위치/구역 부하로 점수화(ParallelFor) 후 Ev.PointRoll로 가중치 샘플링
+	bool PickSpawnPoint(FName Tag, FNSWorkTypeId Type, const FNSSpawnEvent& Ev, FTransform& Out, uint8& OutStainMask, int32& OutZone);
+
+	// 도래한 이벤트 대기열 (Head부터 FIFO). 스테이지 전환 시 몰려도 여러 프레임에 나눠 실행
+	TArray<FNSSpawnEvent> SpawnQueue;
+	int32 SpawnQueueHead = 0;
+	int32 PeakQueueDepth = 0;
+	float MaxDrainMs = 0.f;
+
+	int32 GetQueueDepth() const { return SpawnQueue.Num() - SpawnQueueHead; }
+	void ResetSpawnQueue();
+	void DrainSpawnQueue();
+	// 실패한 이벤트를 현재 스케줄 시각 + RetryDelaySec로 되돌림
+	void RequeueFailedEvent(const FNSSpawnEvent& Ev);
+
+	// 시야 판정 대기: 이번 프레임에 트레이스를 걸고 다음 프레임 Drain에서 결과로 스폰/재시도
+	struct FPendingVisibility
+	{
+		FNSSpawnEvent Ev;
+		FTransform Xform;
+		uint8 StainMask = 0;
+		int32 Zone = INDEX_NONE;
+		uint64 IssuedFrame = 0;
+		TArray<FTraceHandle, TInlineAllocator<4>> Traces;
+	};
+	TArray<FPendingVisibility> PendingVisibility;
+	int32 SkippedVisible = 0;
+
+	// 트레이스가 하나라도 걸렸으면 true(판정 대기), 볼 수 있는 카메라가 없으면 false(바로 스폰)
+	bool RequestVisibilityCheck(const FNSSpawnEvent& Ev, const FTransform& Xform, uint8 StainMask, int32 Zone);
+	bool ResolveVisibilityChecks();
+	void CancelVisibilityChecks();
+
+	// Tick 대신: 다음 스케줄 이벤트/스테이지 경계 중 이른 시각에 타이머 하나만 건다
+	void ArmNextWake();
+	void OnScheduleWake();
+	float GetStageEndSec(ESpawnStage Stage) const;
+	void PublishStage() const;
+
+	// 헬퍼
 	void UpdateStage();
 	void TrySpawnTick(float Now);
-	bool TrySpawnPassenger();
-	bool TrySpawnStain();
-	bool TrySpawnRepair();
-	bool TrySpawnShard();
-
-
-	bool FindRandomPointByTag(FName Tag, FTransform& Out) const;
-	bool FindRandomPointByTagEx(FName Tag, FTransform& Out, AActor*& OutPoint) const;
+	// false면 호출자가 Ev를 재시도로 되돌림 (Ev에 재시도 상태를 남길 수 있음)
+	bool ExecuteSpawnEvent(FNSSpawnEvent& Ev);
+	// PooledAtPoint/StainAtPoint 타입: 포인트 선택 → (시야 판정) → CommitAtPoint
+	bool TrySpawnAtPoint(const FNSSpawnEvent& Ev, const UNSWorkTypeDef& Def);
+	// 포인트가 정해진 뒤 실제 스폰 (시야 판정 통과 후에도 여기로)
+	bool CommitAtPoint(const FNSSpawnEvent& Ev, const FTransform& Xform, uint8 StainMask, int32 Zone);
+
+
+	// 스폰 포인트 테이블 (태그별 트랜스폼 + 허용 타입 마스크)
+	TMap<FName, FSpawnPointSet> SpawnPointTable;
+	bool bSpawnPointsDirty = true;
+	FDelegateHandle LevelAddedHandle, LevelRemovedHandle;
+
+	// 레벨(WP 셀/서브레벨)별 포인트 버킷. 로드/언로드 때 그 레벨만 스캔/제거하고 합친 테이블은 다음 조회 때 재구성
+	TMap<TObjectKey<ULevel>, TMap<FName, FSpawnPointSet>> LevelPointBuckets;
+	// 베이크 에셋의 WP 공간 로드 포인트(UNSSpawnPointAsset::StreamedLevelName) 중 로드된 셀 경계 안에 든 인덱스.
+	// 런타임 셀 이름은 쿡 때 정해지므로 셀별로 굽지 않고 셀이 들어올 때 경계로 배정. 겹치는 셀(계층/데이터 레이어)은 테이블 재구성 때 중복 제거
+	TMap<TObjectKey<ULevel>, TArray<int32>> StreamedCellPoints;
+
+	// -run=NSBakeSpawnPoints로 구운 포인트. 지정하면 레벨 액터 대신 여기서 버킷을 만든다(쿡 빌드엔 마커가 없음)
+	UPROPERTY(EditAnywhere, Category = "Spawn|Points")
+	TSoftObjectPtr<UNSSpawnPointAsset> SpawnPointAsset;
+	bool bWarnedMissingPointAsset = false;
+
+	// WP 월드에서 플레이어(스트리밍 소스)로부터 이 거리 밖의 포인트는 후보 제외.
+	// 서버는 기본적으로 모든 셀을 들고 있으므로 클라가 로드한 범위(기본 그리드 로딩 범위)를 근사. 0이면 끔
+	UPROPERTY(EditAnywhere, Category = "Spawn|Streaming", meta = (ClampMin = "0"))
+	float PlayerRelevanceRadius = 25600.f;
+
+	void RescanAllLevels();
+	void ScanLevelPoints(ULevel* Level);
+	void AddBakedLevelPoints(const UNSSpawnPointAsset& Baked, FName LevelName, TMap<FName, FSpawnPointSet>& Bucket);
+	void AddBakedPoint(const UNSSpawnPointAsset& Baked, int32 Index, TMap<FName, FSpawnPointSet>& Bucket);
+	// WP 런타임 셀이면 경계 안의 스트리밍 포인트를 StreamedCellPoints에 배정하고 true
+	bool ScanStreamedCellPoints(const UNSSpawnPointAsset& Baked, ULevel* Level);
+	// 베이크 커맨드렛용: 모든 타입의 스폰 태그 (중복 제거)
+	void GetSpawnTags(TArray<FName>& Out) const;
+	void BuildSpawnPointTable();
+	const FSpawnPointSet* GetSpawnPoints(FName Tag);
+	void OnLevelAdded(ULevel* Level, UWorld* World);
+	void OnLevelRemoved(ULevel* Level, UWorld* World);
+	bool IsRelevantToPlayers(const FVector& Pos) const;
+
+	bool FindRandomPointByTag(FName Tag, FTransform& Out);
+	// PointIndex가 INDEX_NONE이면 랜덤, 아니면 테이블 크기로 나눈 나머지 위치
+	bool FindPointByTag(FName Tag, int32 PointIndex, FTransform& Out, uint8& OutStainMask);
+	// 위와 같되 점유된 포인트는 건너뛰고 다음 인덱스를 시도 (MaxPointProbes개까지)
+	bool FindFreePointByTag(FName Tag, FNSWorkTypeId Type, int32 PointIndex, FTransform& Out, uint8& OutStainMask, int32& OutZone);
 	void LogStageChange(ESpawnStage From, ESpawnStage To) const;
 	void LogBatch(const FString& What, int32 Count) const;
 };
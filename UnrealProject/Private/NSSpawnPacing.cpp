@@ -0,0 +1,41 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSSpawnPacing.h"
+
+void FNSSpawnPacing::Reset()
+{
+	SmoothedFrameMs = 0.f;
+	Rate = 1.f;
+	QuotaScale = 1.f;
+	MinRateSeen = 1.f;
+}
+
+void FNSSpawnPacing::Update(const FNSSpawnPacingConfig& C, float FrameMs, float BudgetMs, int32 Players, int32 UnresolvedWork)
+{
+	if (!C.bEnabled)
+	{
+		Rate = QuotaScale = 1.f;
+		return;
+	}
+
+	SmoothedFrameMs = (SmoothedFrameMs <= 0.f) ? FrameMs : FMath::Lerp(SmoothedFrameMs, FrameMs, C.SmoothAlpha);
+
+	// 서버 부하: 예산의 BackoffStart부터 1.0까지 선형으로 MinLoadRate까지
+	const float Load = BudgetMs > 0.f ? SmoothedFrameMs / BudgetMs : 0.f;
+	const float LoadT = FMath::Clamp((Load - C.BackoffStart) / FMath::Max(1.f - C.BackoffStart, 0.01f), 0.f, 1.f);
+	const float LoadRate = FMath::Lerp(1.f, C.MinLoadRate, LoadT);
+
+	// 인원: 1명 SoloRate → FullPlayers명 1
+	const float PlayerT = C.FullPlayers > 1 ? FMath::Clamp((Players - 1) / float(C.FullPlayers - 1), 0.f, 1.f) : 1.f;
+	const float PlayerRate = FMath::Lerp(C.SoloRate, 1.f, PlayerT);
+
+	// 미해결 업무: SoftCap 초과분만큼 속도만 줄임 (쿼터는 유지해서 하루 총량은 보존)
+	const float BacklogRate = C.BacklogSoftCap > 0
+		? FMath::Clamp(1.f - float(UnresolvedWork - C.BacklogSoftCap) / C.BacklogSoftCap, C.BacklogMinRate, 1.f)
+		: 1.f;
+
+	Rate = FMath::Clamp(LoadRate * PlayerRate * BacklogRate, 0.1f, 1.f);
+	QuotaScale = FMath::Clamp(LoadRate * PlayerRate, 0.1f, 1.f);
+	MinRateSeen = FMath::Min(MinRateSeen, Rate);
+}
@@ -0,0 +1,47 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NSSpawnPacing.generated.h"
+
+USTRUCT(BlueprintType)
+struct FNSSpawnPacingConfig
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere) bool bEnabled = true;
+	// 서버 프레임 예산(ms). 0이면 NetServerMaxTickRate에서 계산
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0")) float FrameBudgetMs = 0.f;
+	// 평활 프레임 작업시간이 예산의 이 비율을 넘으면 감속 시작 (틱레이트를 놓치기 전에)
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0.1", ClampMax = "0.99")) float BackoffStart = 0.75f;
+	// 예산을 다 쓸 때의 최저 속도/쿼터 배율
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0.1", ClampMax = "1")) float MinLoadRate = 0.35f;
+	// 1인 플레이일 때 속도/쿼터 배율 (FullPlayers에서 1)
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0.1", ClampMax = "1")) float SoloRate = 0.6f;
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "1")) int32 FullPlayers = 4;
+	// 미해결 업무가 이 개수를 넘으면 스폰 속도만 줄임 (2배에서 BacklogMinRate)
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0")) int32 BacklogSoftCap = 8;
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0.1", ClampMax = "1")) float BacklogMinRate = 0.5f;
+	// 프레임 시간 지수 평활 계수 / 샘플 간격
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0.01", ClampMax = "1")) float SmoothAlpha = 0.2f;
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0.1")) float SampleSec = 0.5f;
+};
+
+/**
+ * 런타임 스폰 페이싱. Rate는 스케줄 시계 속도(= 쿨다운 배율의 역수), QuotaScale은 스테이지 쿼터 배율.
+ * 둘 다 1 이하로만 움직여 부하/인원/미해결 업무에 따라 물러나기만 한다.
+ */
+struct FNSSpawnPacing
+{
+	float SmoothedFrameMs = 0.f;
+	float Rate = 1.f;
+	float QuotaScale = 1.f;
+	float MinRateSeen = 1.f;
+
+	void Reset();
+	void Update(const FNSSpawnPacingConfig& Config, float FrameMs, float BudgetMs, int32 Players, int32 UnresolvedWork);
+
+	// 0은 0 그대로, 그 외엔 최소 1
+	int32 ScaleQuota(int32 Base) const { return Base > 0 ? FMath::Max(1, FMath::RoundToInt(Base * QuotaScale)) : 0; }
+};
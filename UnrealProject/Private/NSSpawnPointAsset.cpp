@@ -0,0 +1,66 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSSpawnPointAsset.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
+
+const FName UNSSpawnPointAsset::StreamedLevelName(TEXT("__WorldPartitionStreamed"));
+
+const FNSBakedSpawnLevel* UNSSpawnPointAsset::FindLevel(FName LevelName) const
+{
+	return Levels.FindByPredicate([LevelName](const FNSBakedSpawnLevel& L) { return L.Name == LevelName; });
+}
+
+FName UNSSpawnPointAsset::GetLevelName(const ULevel* Level)
+{
+	if (!Level) return NAME_None;
+	return FName(FPackageName::GetShortName(UWorld::RemovePIEPrefix(Level->GetOutermost()->GetName())));
+}
+
+FName UNSSpawnPointAsset::GetZoneName(const AActor* Marker, FName LevelName)
+{
+	static const FString ZonePrefix = TEXT("Zone_");
+
+	for (const FName& Tag : Marker->Tags)
+	{
+		if (Tag.ToString().StartsWith(ZonePrefix)) return Tag;
+	}
+	return LevelName;
+}
+
+#if WITH_EDITOR
+EDataValidationResult UNSSpawnPointAsset::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = Super::IsDataValid(Context);
+
+	int32 Covered = 0;
+	for (const FNSBakedSpawnLevel& L : Levels)
+	{
+		if (L.First != Covered || L.Num < 0)
+		{
+			Context.AddError(FText::FromString(FString::Printf(TEXT("Level %s range is not contiguous; re-bake"), *L.Name.ToString())));
+			return EDataValidationResult::Invalid;
+		}
+		Covered += L.Num;
+	}
+	if (Covered != Points.Num())
+	{
+		Context.AddError(FText::FromString(TEXT("Level ranges do not cover all points; re-bake")));
+		return EDataValidationResult::Invalid;
+	}
+	for (const FNSBakedSpawnPoint& P : Points)
+	{
+		if (!ZoneNames.IsValidIndex(P.Zone))
+		{
+			Context.AddError(FText::FromString(TEXT("Point references a missing zone; re-bake")));
+			return EDataValidationResult::Invalid;
+		}
+	}
+	return Result;
+}
+#endif
@@ -0,0 +1,70 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "NSTypes.h"
+#include "NSSpawnPointAsset.generated.h"
+
+// 베이크된 스폰 포인트 하나 (마커 액터 대신 위치/회전 + 비트마스크만)
+USTRUCT()
+struct FNSBakedSpawnPoint
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FVector3f Location = FVector3f::ZeroVector;
+	UPROPERTY() FQuat4f Rotation = FQuat4f::Identity;
+	UPROPERTY() uint32 TagMask = 0;    // 1 << UNSSpawnPointAsset::Tags 인덱스 (Spawn_* 마커 태그)
+	UPROPERTY() uint8 StainMask = 0;   // 1 << EStainType (Stain_Wall/Floor/Object 태그)
+	UPROPERTY() uint16 Zone = 0;       // ZoneNames 인덱스
+
+	FTransform ToTransform() const { return FTransform(FQuat(Rotation), FVector(Location)); }
+};
+
+// 레벨(서브레벨/월드)별 포인트 구간. Points는 레벨 순으로 정렬되어 있음
+USTRUCT()
+struct FNSBakedSpawnLevel
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FName Name;
+	UPROPERTY() int32 First = 0;
+	UPROPERTY() int32 Num = 0;
+};
+
+/**
+ * 맵의 스폰 마커(Spawn_* 태그 액터)를 -run=NSBakeSpawnPoints로 구운 결과.
+ * 디렉터는 이 에셋이 지정되면 레벨 액터를 훑지 않고 여기서 포인트 버킷을 만든다.
+ */
+UCLASS(BlueprintType)
+class UNSSpawnPointAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(VisibleAnywhere, Category = "Bake") FName SourceMap;
+	UPROPERTY(VisibleAnywhere, Category = "Bake") FDateTime BakedAt;
+
+	// 베이크한 스폰 태그 (업무 타입 목록 순서와 무관)
+	UPROPERTY() TArray<FName> Tags;
+	UPROPERTY() TArray<FNSBakedSpawnLevel> Levels;
+	UPROPERTY() TArray<FName> ZoneNames;
+	UPROPERTY() TArray<FNSBakedSpawnPoint> Points;
+
+	const FNSBakedSpawnLevel* FindLevel(FName LevelName) const;
+
+	// WP 공간 로드 마커가 묶이는 레벨 이름. 런타임 셀 레벨 이름은 쿡 때 정해지므로
+	// 디렉터가 셀이 로드될 때 셀 경계로 포함 여부를 정한다 (공간 로드가 아닌 WP 액터는 퍼시스턴트 레벨 이름)
+	static const FName StreamedLevelName;
+
+	// 런타임 스캔과 베이크가 같은 규칙을 쓰도록 여기 둠
+	// 레벨 이름: 패키지 짧은 이름 (PIE 접두어 제거)
+	static FName GetLevelName(const ULevel* Level);
+	// 구역 이름: 첫 Zone_* 태그, 없으면 레벨 이름 (WP 스트리밍 포인트도 퍼시스턴트 레벨 이름)
+	static FName GetZoneName(const AActor* Marker, FName LevelName);
+
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
+#endif
+};
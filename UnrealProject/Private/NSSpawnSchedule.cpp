@@ -0,0 +1,117 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSSpawnSchedule.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+
+ESpawnStage FNSSpawnScheduleParams::StageAt(float Time) const
+{
+	if (Time < StageEndSec[0])      return ESpawnStage::Early;
+	else if (Time < StageEndSec[1]) return ESpawnStage::Peak;
+	else if (Time < StageEndSec[2]) return ESpawnStage::Cleanup;
+	return ESpawnStage::Inactive;
+}
+
+int32 FNSSpawnScheduleParams::QuotaAt(ESpawnStage Stage, FNSWorkTypeId Type) const
+{
+	if (Stage == ESpawnStage::Inactive || !Types.IsValidIndex(int32(Type))) return 0;
+	return Types[int32(Type)].Quota[int32(Stage) - 1];
+}
+
+void FNSSpawnSchedule::Build(const FNSSpawnScheduleParams& Params, int32 InSeed)
+{
+	Seed = InSeed;
+	Events.Reset();
+	Cursor = 0;
+
+	FRandomStream Rng(Seed);
+	const float DayEnd = Params.StageEndSec[NumSpawnStages - 1];
+
+	// 타입별로 런타임 규칙 그대로 재현: 쿼터 미달이면 스폰 후 쿨다운, 쿼터 찼으면 다음 스테이지까지 대기
+	for (int32 TypeIdx = 0; TypeIdx < Params.Types.Num(); ++TypeIdx)
+	{
+		const FNSScheduleWorkType& TypeParams = Params.Types[TypeIdx];
+		const FNSWorkTypeId Type = FNSWorkTypeId(TypeIdx);
+		const float Cooldown = FMath::Max(0.1f, TypeParams.CooldownSec);
+		int32 Spawned = 0;
+
+		float T = 0.f;
+		while (T < DayEnd)
+		{
+			const ESpawnStage Stage = Params.StageAt(T);
+			if (Spawned >= Params.QuotaAt(Stage, Type))
+			{
+				T = Params.StageEndSec[int32(Stage) - 1];
+				continue;
+			}
+
+			FNSSpawnEvent& Ev = Events.AddDefaulted_GetRef();
+			Ev.Time = T;
+			Ev.Type = Type;
+
+			if (TypeParams.bPoolPick)
+			{
+				Ev.PointIndex = Rng.RandHelper(MAX_int32);
+			}
+			else if (TypeParams.PointCount > 0)
+			{
+				Ev.PointIndex = Rng.RandHelper(TypeParams.PointCount);
+			}
+
+			Ev.PointRoll = Rng.FRand();
+
+			if (TypeParams.bStainTypes)
+			{
+				const uint8 Mask = Params.StainMasks.IsValidIndex(Ev.PointIndex) ? Params.StainMasks[Ev.PointIndex] : 0;
+				Ev.StainType = PickStainType(Mask, Rng);
+			}
+
+			++Spawned;
+			T += Cooldown;
+		}
+	}
+
+	// 같은 시각이면 타입 순서 유지
+	Algo::StableSortBy(Events, &FNSSpawnEvent::Time);
+}
+
+const FNSSpawnEvent* FNSSpawnSchedule::PeekDue(float Now) const
+{
+	return (Events.IsValidIndex(Cursor) && Events[Cursor].Time <= Now) ? &Events[Cursor] : nullptr;
+}
+
+void FNSSpawnSchedule::DeferCurrent(float DelaySec)
+{
+	if (!Events.IsValidIndex(Cursor)) return;
+
+	FNSSpawnEvent Ev = Events[Cursor];
+	Ev.Time += FMath::Max(0.1f, DelaySec);
+	Events.RemoveAt(Cursor, 1, EAllowShrinking::No);
+	Requeue(Ev);
+}
+
+void FNSSpawnSchedule::Requeue(const FNSSpawnEvent& Ev)
+{
+	// 커서 이후 구간에서 정렬 위치 찾기
+	const TArrayView<FNSSpawnEvent> Pending(Events.GetData() + Cursor, Events.Num() - Cursor);
+	const int32 At = Cursor + Algo::UpperBoundBy(Pending, Ev.Time, &FNSSpawnEvent::Time);
+	Events.Insert(Ev, At);
+}
+
+EStainType FNSSpawnSchedule::PickStainType(uint8 AllowedMask, FRandomStream& Rng)
+{
+	// 태그가 하나도 없으면 전 타입 허용
+	if (AllowedMask == 0)
+	{
+		AllowedMask = (1u << uint8(EStainType::Wall)) | (1u << uint8(EStainType::Object)) | (1u << uint8(EStainType::Floor));
+	}
+
+	// 세트 비트 중 N번째 (비트는 최대 3개)
+	int32 Nth = Rng.RandHelper(FMath::CountBits(AllowedMask));
+	for (uint32 Bits = AllowedMask; Bits; Bits &= Bits - 1)
+	{
+		if (Nth-- == 0) return EStainType(FMath::CountTrailingZeros(Bits));
+	}
+	return EStainType::Wall;
+}
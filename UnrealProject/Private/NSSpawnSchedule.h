@@ -0,0 +1,71 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NSTypes.h"
+
+static constexpr int32 NumSpawnStages = 3; // Early/Peak/Cleanup
+
+// 하루치 스케줄의 스폰 이벤트 하나
+struct FNSSpawnEvent
+{
+	float Time = 0.f;
+	FNSWorkTypeId Type = WorkTypeId(EWorkType::Passenger);
+	EStainType StainType = EStainType::None;
+	// 태그별 포인트 테이블 인덱스 (수리는 유휴 풀에서 고를 선택값)
+	int32 PointIndex = INDEX_NONE;
+	// 가중치 샘플링용 [0,1) 난수 (포인트 점수화가 켜져 있으면 PointIndex 대신 사용)
+	float PointRoll = 0.f;
+	// 부하로 줄어든 쿼터에 걸려 되돌린 적 있음 (QuotaFull 실패는 이벤트당 1회만 기록)
+	bool bQuotaDeferred = false;
+};
+
+// 타입 하나의 스케줄 입력 (인덱스 = 타입 ID)
+struct FNSScheduleWorkType
+{
+	int32 Quota[NumSpawnStages] = {};
+	float CooldownSec = 0.f;
+	int32 PointCount = 0;
+	bool bPoolPick = false;     // PointIndex를 포인트 대신 수리 풀 선택값(전체 int 범위)으로
+	bool bStainTypes = false;   // 이벤트마다 StainMasks로 얼룩 타입을 미리 뽑음
+};
+
+// 스케줄 입력: 디렉터 설정(쿼터/쿨다운/스테이지)과 포인트 정보만 담는다. 월드 불필요
+struct FNSSpawnScheduleParams
+{
+	float StageEndSec[NumSpawnStages] = { 120.f, 480.f, 600.f };
+	TArray<FNSScheduleWorkType> Types;
+	TArray<uint8> StainMasks;   // 얼룩 포인트별 허용 EStainType 마스크
+
+	ESpawnStage StageAt(float Time) const;
+	int32 QuotaAt(ESpawnStage Stage, FNSWorkTypeId Type) const;
+};
+
+/**
+ * 시드 하나로 하루 전체 스폰 이벤트(시간/포인트/타입/얼룩 타입)를 미리 계산하고
+ * 시간순 배열을 커서로 실행한다. 같은 시드+설정이면 항상 같은 스케줄.
+ */
+struct FNSSpawnSchedule
+{
+	int32 Seed = 0;
+	TArray<FNSSpawnEvent> Events;
+	int32 Cursor = 0;
+
+	void Build(const FNSSpawnScheduleParams& Params, int32 InSeed);
+	void Reset() { Events.Reset(); Cursor = 0; }
+
+	// Now까지 도래한 다음 이벤트 (없으면 nullptr)
+	const FNSSpawnEvent* PeekDue(float Now) const;
+	void Advance() { ++Cursor; }
+	// 현재 이벤트 실행 실패 → DelaySec 뒤로 미뤄 정렬 위치에 다시 넣기
+	void DeferCurrent(float DelaySec);
+	// 이미 꺼낸 이벤트를 Ev.Time 기준 정렬 위치(커서 이후)에 다시 넣기
+	void Requeue(const FNSSpawnEvent& Ev);
+
+	bool IsDone() const { return Cursor >= Events.Num(); }
+	// 다음 미실행 이벤트 시각 (없으면 MAX_flt)
+	float NextTime() const { return Events.IsValidIndex(Cursor) ? Events[Cursor].Time : MAX_flt; }
+
+	static EStainType PickStainType(uint8 AllowedMask, FRandomStream& Rng);
+};
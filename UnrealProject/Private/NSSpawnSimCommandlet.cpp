@@ -0,0 +1,270 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSSpawnSimCommandlet.h"
+#include "NSSpawnDirector.h"
+#include "NSSpawnSchedule.h"
+#include "NSGameModeBase.h"
+#include "NSWorkTypeDef.h"
+#include "Async/ParallelFor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Parse.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	struct FSimConfig
+	{
+		FNSSpawnScheduleParams Schedule;
+		int32 MaxRepairs = 2;
+		float RetrySec = 1.f;
+		int32 Penalty = 0;
+		int32 MaxDays = 7;
+		int32 Players = 4;
+		float TravelSec = 12.f;
+
+		// 타입 ID별 (디렉터 업무 타입 정의에서)
+		TArray<float> ClearSec;
+		TArray<int32> Score;
+		TArray<bool> bCountsAsWork;   // 승객처럼 false면 처리 대상 아님
+		int32 RepairType = INDEX_NONE; // 동시 최대치 제한 대상
+	};
+
+	struct FSimDay
+	{
+		int32 Score = 0;
+		int32 Leftover = 0;
+		int32 Reputation = 0;
+	};
+
+	struct FSimCampaign
+	{
+		TArray<FSimDay, TInlineAllocator<8>> Days;
+		bool bGameOver = false;
+		bool bCleared = false;
+	};
+
+	// 0.5초 스텝: 스케줄 실행 → 플레이어가 가장 오래된 작업부터 처리 (이동+처리 시간, 숙련도 편차)
+	FSimDay SimulateDay(const FSimConfig& C, FRandomStream& Rng, float Skill, int32& InOutReputation)
+	{
+		FNSSpawnSchedule Schedule;
+		Schedule.Build(C.Schedule, Rng.RandHelper(MAX_int32 - 1) + 1);
+
+		struct FPlayer { float FreeAt = 0.f; int32 Busy = INDEX_NONE; };
+		TArray<FPlayer, TInlineAllocator<8>> Players;
+		Players.SetNum(FMath::Max(1, C.Players));
+
+		TArray<int32> Queue;       // 타입 ID, 오래된 순
+		int32 Broken = 0;          // 활성 수리(대기+처리중)
+		int32 DayScore = 0;
+
+		constexpr float Dt = 0.5f;
+		const float DayEnd = C.Schedule.StageEndSec[NumSpawnStages - 1];
+
+		for (float T = 0.f; T < DayEnd; T += Dt)
+		{
+			for (FPlayer& P : Players)
+			{
+				if (P.Busy == INDEX_NONE || P.FreeAt > T) continue;
+				DayScore += C.Score[P.Busy];
+				if (P.Busy == C.RepairType) --Broken;
+				P.Busy = INDEX_NONE;
+			}
+
+			while (const FNSSpawnEvent* Ev = Schedule.PeekDue(T))
+			{
+				// 런타임과 동일: 수리 동시 최대치면 재시도
+				const int32 Type = int32(Ev->Type);
+				if (Type == C.RepairType && Broken >= C.MaxRepairs)
+				{
+					Schedule.DeferCurrent(C.RetrySec);
+					continue;
+				}
+				if (C.bCountsAsWork[Type])
+				{
+					Queue.Add(Type);
+					if (Type == C.RepairType) ++Broken;
+				}
+				Schedule.Advance();
+			}
+
+			for (FPlayer& P : Players)
+			{
+				if (P.Busy != INDEX_NONE || Queue.Num() == 0) continue;
+				const int32 W = Queue[0];
+				Queue.RemoveAt(0, 1, EAllowShrinking::No);
+				P.Busy = W;
+				P.FreeAt = T + (C.TravelSec + C.ClearSec[W]) * Skill * (0.5f + Rng.FRand());
+			}
+		}
+
+		// 남은 작업 = 대기 중 + 처리 중(GetAliveWorkCount와 같은 기준)
+		int32 Leftover = Queue.Num();
+		for (const FPlayer& P : Players)
+		{
+			if (P.Busy != INDEX_NONE) ++Leftover;
+		}
+
+		ANSGameModeBase::ApplyDayEvaluation(DayScore, InOutReputation, Leftover, C.Penalty);
+
+		FSimDay Out;
+		Out.Score = DayScore;
+		Out.Leftover = Leftover;
+		Out.Reputation = InOutReputation;
+		return Out;
+	}
+
+	FSimCampaign SimulateCampaign(const FSimConfig& C, int32 Seed)
+	{
+		FRandomStream Rng(Seed);
+		const float Skill = FMath::Lerp(0.75f, 1.25f, Rng.FRand());
+
+		FSimCampaign R;
+		int32 Reputation = 1;   // ANSGameState 기본값
+		for (int32 Day = 1; ; ++Day)
+		{
+			R.Days.Add(SimulateDay(C, Rng, Skill, Reputation));
+
+			// ResetForNextDay와 같은 판정
+			if (Reputation <= 0)    { R.bGameOver = true; break; }
+			if (Day >= C.MaxDays)   { R.bCleared = true;  break; }
+		}
+		return R;
+	}
+
+	int32 Percentile(const TArray<int32>& Sorted, float P)
+	{
+		if (Sorted.Num() == 0) return 0;
+		return Sorted[FMath::Clamp(FMath::FloorToInt(P * (Sorted.Num() - 1)), 0, Sorted.Num() - 1)];
+	}
+}
+
+UNSSpawnSimCommandlet::UNSSpawnSimCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UNSSpawnSimCommandlet::Main(const FString& Params)
+{
+	const TCHAR* Cmd = *Params;
+
+	// 디렉터/게임모드 설정은 CDO(BP 지정 시 BP 기본값)에서 읽음
+	UClass* DirectorClass = ANSSpawnDirector::StaticClass();
+	FString Path;
+	if (FParse::Value(Cmd, TEXT("Director="), Path))
+	{
+		DirectorClass = LoadClass<ANSSpawnDirector>(nullptr, *Path);
+		if (!DirectorClass) { UE_LOG(LogTemp, Error, TEXT("[SIM] Director class not found: %s"), *Path); return 1; }
+	}
+	UClass* GameModeClass = ANSGameModeBase::StaticClass();
+	if (FParse::Value(Cmd, TEXT("GameMode="), Path))
+	{
+		GameModeClass = LoadClass<ANSGameModeBase>(nullptr, *Path);
+		if (!GameModeClass) { UE_LOG(LogTemp, Error, TEXT("[SIM] GameMode class not found: %s"), *Path); return 1; }
+	}
+
+	const ANSSpawnDirector* Dir = GetDefault<ANSSpawnDirector>(DirectorClass);
+	const ANSGameModeBase* GM = GetDefault<ANSGameModeBase>(GameModeClass);
+
+	FSimConfig C;
+	Dir->FillScheduleConfig(C.Schedule);
+	C.MaxRepairs = Dir->GetMaxSimultaneousRepairs();
+	C.RetrySec = Dir->GetRetryDelaySec();
+	C.Penalty = GM->PenaltyPerLeftover;
+	C.MaxDays = ANSGameModeBase::GetMaxDays();
+
+	int32 NumCampaigns = 5000;
+	int32 BaseSeed = 1;
+	FParse::Value(Cmd, TEXT("Campaigns="), NumCampaigns);
+	FParse::Value(Cmd, TEXT("Seed="), BaseSeed);
+	FParse::Value(Cmd, TEXT("Players="), C.Players);
+	FParse::Value(Cmd, TEXT("Penalty="), C.Penalty);
+	FParse::Value(Cmd, TEXT("TravelSec="), C.TravelSec);
+
+	// 타입별 처리 시간/점수. 얼룩/수리 점수는 게임플레이 코드가 GameMode 값으로 줌
+	TArray<TObjectPtr<UNSWorkTypeDef>> Defs;
+	Dir->MakeWorkTypes(Defs);
+	for (int32 T = 0; T < Defs.Num(); ++T)
+	{
+		const UNSWorkTypeDef* Def = Defs[T];
+		float ClearSec = Def->SimClearSec;
+		FParse::Value(Cmd, *FString::Printf(TEXT("%sClearSec="), *Def->GetTypeName().ToString()), ClearSec);
+
+		int32 Score = Def->CompletionScore;
+		if (Def->SpawnMode == EWorkSpawnMode::StainAtPoint) Score += GM->ScorePerStain;
+		if (Def->SpawnMode == EWorkSpawnMode::RepairPool)
+		{
+			Score += GM->ScorePerRepair;
+			if (C.RepairType == INDEX_NONE) C.RepairType = T;
+		}
+
+		C.ClearSec.Add(ClearSec);
+		C.Score.Add(Score);
+		C.bCountsAsWork.Add(Def->bCountsAsWork);
+	}
+	NumCampaigns = FMath::Max(1, NumCampaigns);
+
+	const double StartSec = FPlatformTime::Seconds();
+
+	TArray<FSimCampaign> Results;
+	Results.SetNum(NumCampaigns);
+	ParallelFor(NumCampaigns, [&](int32 Idx)
+		{
+			Results[Idx] = SimulateCampaign(C, BaseSeed + Idx);
+		});
+
+	const double ElapsedSec = FPlatformTime::Seconds() - StartSec;
+
+	// 집계 + CSV (캠페인/일자별 한 줄)
+	TArray<int32> Scores, Leftovers;
+	int32 GameOvers = 0, Cleared = 0, TotalDays = 0;
+	FString Csv = TEXT("campaign,day,score,leftover,reputation\n");
+	for (int32 i = 0; i < Results.Num(); ++i)
+	{
+		const FSimCampaign& R = Results[i];
+		GameOvers += R.bGameOver ? 1 : 0;
+		Cleared += R.bCleared ? 1 : 0;
+		for (int32 d = 0; d < R.Days.Num(); ++d)
+		{
+			const FSimDay& D = R.Days[d];
+			Scores.Add(D.Score);
+			Leftovers.Add(D.Leftover);
+			Csv += FString::Printf(TEXT("%d,%d,%d,%d,%d\n"), i, d + 1, D.Score, D.Leftover, D.Reputation);
+		}
+		TotalDays += R.Days.Num();
+	}
+	Scores.Sort();
+	Leftovers.Sort();
+
+	UE_LOG(LogTemp, Display, TEXT("[SIM] %d campaigns (%d days) in %.2fs, players=%d penalty=%d"),
+		NumCampaigns, TotalDays, ElapsedSec, C.Players, C.Penalty);
+	UE_LOG(LogTemp, Display, TEXT("[SIM] GameOver %.1f%%  Cleared %.1f%%  AvgDays %.2f"),
+		100.f * GameOvers / NumCampaigns, 100.f * Cleared / NumCampaigns, float(TotalDays) / NumCampaigns);
+	UE_LOG(LogTemp, Display, TEXT("[SIM] DayScore  p10=%d p50=%d p90=%d"),
+		Percentile(Scores, 0.1f), Percentile(Scores, 0.5f), Percentile(Scores, 0.9f));
+	UE_LOG(LogTemp, Display, TEXT("[SIM] Leftover  p10=%d p50=%d p90=%d max=%d"),
+		Percentile(Leftovers, 0.1f), Percentile(Leftovers, 0.5f), Percentile(Leftovers, 0.9f), Leftovers.Num() ? Leftovers.Last() : 0);
+
+	// 남은 작업 히스토그램 (마지막 칸은 그 이상)
+	constexpr int32 Buckets = 16;
+	int32 Hist[Buckets] = {};
+	for (int32 L : Leftovers) Hist[FMath::Min(L, Buckets - 1)]++;
+	for (int32 b = 0; b < Buckets; ++b)
+	{
+		if (Hist[b] == 0) continue;
+		UE_LOG(LogTemp, Display, TEXT("[SIM]   leftover %2d%s : %6.2f%%"),
+			b, b == Buckets - 1 ? TEXT("+") : TEXT(" "), 100.f * Hist[b] / FMath::Max(1, Leftovers.Num()));
+	}
+
+	const FString OutPath = FPaths::ProjectSavedDir() / TEXT("SpawnSim") /
+		FString::Printf(TEXT("SpawnSim_%s.csv"), *FDateTime::Now().ToString());
+	if (FFileHelper::SaveStringToFile(Csv, *OutPath))
+	{
+		UE_LOG(LogTemp, Display, TEXT("[SIM] Wrote %s"), *OutPath);
+	}
+	return 0;
+}
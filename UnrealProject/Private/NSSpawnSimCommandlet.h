@@ -0,0 +1,25 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "NSSpawnSimCommandlet.generated.h"
+
+/**
+ * 월드 없이 스폰 스케줄 + 단순 클리어 모델로 7일 캠페인을 대량 시뮬레이션 (쿼터/쿨다운 밸런싱용)
+ *
+ * UnrealEditor-Cmd.exe UnrealProject -run=NSSpawnSim -Campaigns=5000 -Players=4
+ *   [-Seed=1] [-Director=/Game/.../BP_SpawnDirector.BP_SpawnDirector_C] [-GameMode=...]
+ *   [-<TypeName>ClearSec=N (예: -StainClearSec=6, 기본값은 업무 타입 정의의 SimClearSec)] [-TravelSec=12] [-Penalty=N]
+ */
+UCLASS()
+class UNSSpawnSimCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UNSSpawnSimCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
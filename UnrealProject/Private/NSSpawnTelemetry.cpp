@@ -0,0 +1,175 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSSpawnTelemetry.h"
+#include "NSWorkRegistry.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+
+namespace
+{
+	const TCHAR* FailReasonName(int32 Reason)
+	{
+		switch (ESpawnFailReason(Reason))
+		{
+		case ESpawnFailReason::NoPoint:   return TEXT("fail_no_point");
+		case ESpawnFailReason::QuotaFull: return TEXT("fail_quota_full");
+		case ESpawnFailReason::Collision: return TEXT("fail_collision");
+		case ESpawnFailReason::Visible:   return TEXT("fail_visible");
+		case ESpawnFailReason::NoClass:   return TEXT("fail_no_class");
+		default:                          return TEXT("fail_unknown");
+		}
+	}
+
+	const TCHAR* StageName(int32 Stage)
+	{
+		switch (ESpawnStage(Stage))
+		{
+		case ESpawnStage::Early:   return TEXT("Early");
+		case ESpawnStage::Peak:    return TEXT("Peak");
+		case ESpawnStage::Cleanup: return TEXT("Cleanup");
+		default:                   return TEXT("Inactive");
+		}
+	}
+}
+
+void FNSSpawnTelemetry::Open(const FString& InPath)
+{
+	Path = InPath;
+	bWroteHeader = false;
+}
+
+void FNSSpawnTelemetry::ResetDay()
+{
+	FMemory::Memzero(Attempts);
+	FMemory::Memzero(Successes);
+	FMemory::Memzero(Fails);
+	for (FHistogram& H : CostUs) H = FHistogram();
+	for (FHistogram& H : ResolveSec) H = FHistogram();
+	AliveTimes.Reset();
+	AliveStages.Reset();
+	AliveCounts.Reset();
+	NetSamples.Reset();
+}
+
+int32 FNSSpawnTelemetry::BucketOf(double Value)
+{
+	// 0: <1, b: [2^(b-1), 2^b)
+	if (Value < 1.0) return 0;
+	return FMath::Min(int32(FMath::FloorLog2_64(uint64(Value))) + 1, NumBuckets - 1);
+}
+
+void FNSSpawnTelemetry::FHistogram::Add(double Value)
+{
+	++Counts[BucketOf(Value)];
+	++Num;
+	Sum += Value;
+	Max = FMath::Max(Max, Value);
+}
+
+void FNSSpawnTelemetry::RecordSpawnCost(FNSWorkTypeId Type, uint64 Cycles)
+{
+	CostUs[int32(Type)].Add(FPlatformTime::ToSeconds64(Cycles) * 1e6);
+}
+
+void FNSSpawnTelemetry::RecordResolved(FNSWorkTypeId Type, float Sec)
+{
+	ResolveSec[int32(Type)].Add(FMath::Max(0.f, Sec));
+}
+
+void FNSSpawnTelemetry::SampleAlive(float Time, ESpawnStage Stage, const FNSWorkRegistry& Work, int32 NumTypes)
+{
+	// 타입 수가 바뀌면(목록 교체) 이전 샘플은 버림
+	if (AliveTypes != NumTypes)
+	{
+		AliveTimes.Reset();
+		AliveStages.Reset();
+		AliveCounts.Reset();
+		AliveTypes = NumTypes;
+	}
+
+	AliveTimes.Add(Time);
+	AliveStages.Add(Stage);
+	for (int32 T = 0; T < NumTypes; ++T)
+	{
+		AliveCounts.Add(Work.Count(FNSWorkTypeId(T)));
+	}
+}
+
+void FNSSpawnTelemetry::SampleNet(float Time, ESpawnStage Stage, bool bIris, float FrameMs, float OutKBps, int32 Connections)
+{
+	NetSamples.Add({ Time, Stage, bIris, FrameMs, OutKBps, Connections });
+}
+
+bool FNSSpawnTelemetry::Flush(int32 Day, const TArray<FString>& TypeNames, const FNSWorkRegistry& Work)
+{
+	if (!IsOpen()) return false;
+
+	FString Csv;
+	Csv.Reserve(16 * 1024);
+	if (!bWroteHeader)
+	{
+		Csv += TEXT("day,metric,type,stage,bucket,value\n");
+	}
+
+	const int32 NumTypes = FMath::Min(TypeNames.Num(), int32(MaxWorkTypes));
+	auto Row = [&](const TCHAR* Metric, const FString& Type, const TCHAR* Stage, const FString& Bucket, double Value)
+		{
+			Csv += FString::Printf(TEXT("%d,%s,%s,%s,%s,%s\n"), Day, Metric, *Type, Stage, *Bucket, *FString::SanitizeFloat(Value));
+		};
+	auto Histogram = [&](const TCHAR* Metric, const FString& Type, const FHistogram& H)
+		{
+			if (H.Num == 0) return;
+			for (int32 b = 0; b < NumBuckets; ++b)
+			{
+				if (H.Counts[b] == 0) continue;
+				Row(Metric, Type, TEXT(""), b == NumBuckets - 1 ? FString(TEXT("inf")) : FString::FromInt(1 << b), H.Counts[b]);
+			}
+			Row(Metric, Type, TEXT(""), TEXT("avg"), H.Sum / H.Num);
+			Row(Metric, Type, TEXT(""), TEXT("max"), H.Max);
+		};
+
+	for (int32 T = 0; T < NumTypes; ++T)
+	{
+		const FString& Type = TypeNames[T];
+		for (int32 S = 0; S < NumStages; ++S)
+		{
+			if (Attempts[T][S] == 0 && Successes[T][S] == 0) continue;
+			Row(TEXT("attempt"), Type, StageName(S), TEXT(""), Attempts[T][S]);
+			Row(TEXT("success"), Type, StageName(S), TEXT(""), Successes[T][S]);
+			for (int32 R = 0; R < NumReasons; ++R)
+			{
+				if (Fails[T][S][R] > 0) Row(FailReasonName(R), Type, StageName(S), TEXT(""), Fails[T][S][R]);
+			}
+		}
+		Histogram(TEXT("spawn_cost_us"), Type, CostUs[T]);
+		Histogram(TEXT("resolve_sec"), Type, ResolveSec[T]);
+		Row(TEXT("leftover"), Type, TEXT(""), TEXT(""), Work.Count(FNSWorkTypeId(T)));
+	}
+
+	// 시간축: bucket = 경과 초
+	const int32 SampleTypes = FMath::Min(AliveTypes, NumTypes);
+	for (int32 i = 0; i < AliveTimes.Num(); ++i)
+	{
+		const FString Time = FString::SanitizeFloat(AliveTimes[i]);
+		for (int32 T = 0; T < SampleTypes; ++T)
+		{
+			Row(TEXT("alive"), TypeNames[T], StageName(int32(AliveStages[i])), Time, AliveCounts[i * AliveTypes + T]);
+		}
+	}
+	for (const FNetSample& N : NetSamples)
+	{
+		const FString Mode = N.bIris ? TEXT("iris") : TEXT("legacy");
+		const FString Time = FString::SanitizeFloat(N.Time);
+		Row(TEXT("net_frame_ms"), Mode, StageName(int32(N.Stage)), Time, N.FrameMs);
+		Row(TEXT("net_out_kbps"), Mode, StageName(int32(N.Stage)), Time, N.OutKBps);
+		Row(TEXT("net_connections"), Mode, StageName(int32(N.Stage)), Time, N.Connections);
+	}
+
+	const bool bOk = FFileHelper::SaveStringToFile(Csv, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+		&IFileManager::Get(), bWroteHeader ? FILEWRITE_Append : FILEWRITE_None);
+	bWroteHeader |= bOk;
+	ResetDay();
+	return bOk;
+}
@@ -0,0 +1,93 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NSTypes.h"
+#include "NSSpawnSchedule.h"
+
+struct FNSWorkRegistry;
+
+// 스폰 실패 사유 (텔레메트리 집계 키)
+enum class ESpawnFailReason : uint8
+{
+	NoPoint,     // 태그 포인트 없음 / 수리 풀 비어 있음
+	QuotaFull,   // 스테이지 쿼터 또는 수리 동시 최대치
+	Collision,   // 후보 포인트가 전부 점유 / 스폰 실패
+	Visible,     // 시야 판정에서 플레이어에게 보임
+	NoClass,     // 액터 클래스 미로드
+	Count
+};
+
+/**
+ * 디렉터 텔레메트리. 핫패스에서는 고정 크기 카운터/히스토그램만 올리고,
+ * 라운드 종료 때 세션 CSV(day,metric,type,stage,bucket,value 긴 형식)에 한 번에 덧붙인다.
+ * 히스토그램은 2의 거듭제곱 구간 (bucket = 상한, 마지막은 inf).
+ */
+struct FNSSpawnTelemetry
+{
+	static constexpr int32 NumStages = NumSpawnStages + 1;   // Inactive 포함
+	static constexpr int32 NumReasons = int32(ESpawnFailReason::Count);
+	static constexpr int32 NumBuckets = 16;
+
+	// 세션 파일 경로 지정 (기존 내용 유지, 첫 Flush 때 헤더)
+	void Open(const FString& InPath);
+	bool IsOpen() const { return !Path.IsEmpty(); }
+	const FString& GetPath() const { return Path; }
+
+	void ResetDay();
+
+	void RecordAttempt(FNSWorkTypeId Type, ESpawnStage Stage)  { ++Attempts[int32(Type)][int32(Stage)]; }
+	void RecordSuccess(FNSWorkTypeId Type, ESpawnStage Stage)  { ++Successes[int32(Type)][int32(Stage)]; }
+	void RecordFail(FNSWorkTypeId Type, ESpawnStage Stage, ESpawnFailReason Reason) { ++Fails[int32(Type)][int32(Stage)][int32(Reason)]; }
+	// 스폰 이벤트 1건 처리 비용 (FPlatformTime::Cycles64 차)
+	void RecordSpawnCost(FNSWorkTypeId Type, uint64 Cycles);
+	// 스폰 → 완료까지 걸린 시간
+	void RecordResolved(FNSWorkTypeId Type, float Sec);
+	// 살아 있는 업무 수 스냅샷 (타입별)
+	void SampleAlive(float Time, ESpawnStage Stage, const FNSWorkRegistry& Work, int32 NumTypes);
+	// 서버 복제 부하 스냅샷 (Iris 전환 전후 비교용). type 열 = iris/legacy
+	void SampleNet(float Time, ESpawnStage Stage, bool bIris, float FrameMs, float OutKBps, int32 Connections);
+
+	// 오늘 집계를 파일에 덧붙이고 ResetDay. TypeNames 순서 = 타입 ID
+	bool Flush(int32 Day, const TArray<FString>& TypeNames, const FNSWorkRegistry& Work);
+
+private:
+	static int32 BucketOf(double Value);
+
+	struct FHistogram
+	{
+		int32 Counts[NumBuckets] = {};
+		int32 Num = 0;
+		double Sum = 0.0;
+		double Max = 0.0;
+
+		void Add(double Value);
+	};
+
+	int32 Attempts[MaxWorkTypes][NumStages] = {};
+	int32 Successes[MaxWorkTypes][NumStages] = {};
+	int32 Fails[MaxWorkTypes][NumStages][NumReasons] = {};
+	FHistogram CostUs[MaxWorkTypes];
+	FHistogram ResolveSec[MaxWorkTypes];
+
+	// 샘플별 시각/스테이지 + 타입별 개수(샘플당 AliveTypes개)
+	TArray<float> AliveTimes;
+	TArray<ESpawnStage> AliveStages;
+	TArray<int32> AliveCounts;
+	int32 AliveTypes = 0;
+
+	struct FNetSample
+	{
+		float Time;
+		ESpawnStage Stage;
+		bool bIris;
+		float FrameMs;
+		float OutKBps;
+		int32 Connections;
+	};
+	TArray<FNetSample> NetSamples;
+
+	FString Path;
+	bool bWroteHeader = false;
+};
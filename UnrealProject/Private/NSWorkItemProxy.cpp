@@ -0,0 +1,189 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSWorkItemProxy.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Net/UnrealNetwork.h"
+
+void FNSWorkItemEntry::PostReplicatedAdd(const FNSWorkItemArray& Array)
+{
+	if (Array.Owner) Array.Owner->ShowEntry(*this);
+}
+
+void FNSWorkItemEntry::PostReplicatedChange(const FNSWorkItemArray& Array)
+{
+	if (Array.Owner) Array.Owner->ShowEntry(*this);
+}
+
+void FNSWorkItemEntry::PreReplicatedRemove(const FNSWorkItemArray& Array)
+{
+	if (Array.Owner) Array.Owner->HideEntry(Slot);
+}
+
+ANSWorkItemProxy::ANSWorkItemProxy()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	bAlwaysRelevant = true;
+	SetReplicateMovement(false);
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+void ANSWorkItemProxy::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(ANSWorkItemProxy, Items);
+	DOREPLIFETIME(ANSWorkItemProxy, Visuals);
+}
+
+void ANSWorkItemProxy::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+	Items.Owner = this;
+}
+
+uint8 ANSWorkItemProxy::FindOrAddVisual(UStaticMesh* Mesh, UMaterialInterface* Material)
+{
+	const int32 Found = Visuals.IndexOfByPredicate([&](const FNSWorkItemVisual& V) { return V.Mesh == Mesh && V.Material == Material; });
+	if (Found != INDEX_NONE) return uint8(Found);
+
+	if (Visuals.Num() >= MAX_uint8)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[ITEM] Too many proxy visuals, reusing 0 for %s"), *GetNameSafe(Mesh));
+		return 0;
+	}
+	FNSWorkItemVisual& V = Visuals.AddDefaulted_GetRef();
+	V.Mesh = Mesh;
+	V.Material = Material;
+	return uint8(Visuals.Num() - 1);
+}
+
+void ANSWorkItemProxy::ServerAddItem(int32 Slot, const FTransform& Xform, uint8 Visual)
+{
+	ServerRemoveItem(Slot);
+
+	FNSWorkItemEntry& E = Items.Items.AddDefaulted_GetRef();
+	E.Slot = Slot;
+	E.Location = Xform.GetLocation();
+	E.Rotation = Xform.Rotator();
+	E.Visual = Visual;
+	Items.MarkItemDirty(E);
+	EntryBySlot.Add(Slot, Items.Items.Num() - 1);
+
+	if (IsRenderingNetMode()) ShowEntry(E);
+}
+
+void ANSWorkItemProxy::ServerUpdateItem(int32 Slot, uint8 ProgressQ, bool bMaterialized)
+{
+	const int32* Idx = EntryBySlot.Find(Slot);
+	if (!Idx) return;
+
+	FNSWorkItemEntry& E = Items.Items[*Idx];
+	if (E.ProgressQ == ProgressQ && E.bMaterialized == bMaterialized) return;
+	E.ProgressQ = ProgressQ;
+	E.bMaterialized = bMaterialized;
+	Items.MarkItemDirty(E);
+
+	if (IsRenderingNetMode()) ShowEntry(E);
+}
+
+void ANSWorkItemProxy::ServerRemoveItem(int32 Slot)
+{
+	int32 Idx;
+	if (!EntryBySlot.RemoveAndCopyValue(Slot, Idx)) return;
+
+	// 끝 항목을 당겨 와 O(1) 제거
+	Items.Items.RemoveAtSwap(Idx, 1, EAllowShrinking::No);
+	if (Items.Items.IsValidIndex(Idx)) EntryBySlot.Add(Items.Items[Idx].Slot, Idx);
+	Items.MarkArrayDirty();
+
+	if (IsRenderingNetMode()) HideEntry(Slot);
+}
+
+UInstancedStaticMeshComponent* ANSWorkItemProxy::GetVisualISM(int32 Visual)
+{
+	if (!Visuals.IsValidIndex(Visual) || !Visuals[Visual].Mesh) return nullptr;
+
+	if (VisualISMs.Num() <= Visual)
+	{
+		VisualISMs.SetNum(Visual + 1);
+		FreeInstances.SetNum(Visual + 1);
+	}
+	if (!VisualISMs[Visual])
+	{
+		UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(this);
+		ISM->SetStaticMesh(Visuals[Visual].Mesh);
+		if (Visuals[Visual].Material) ISM->SetMaterial(0, Visuals[Visual].Material);
+		ISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		ISM->SetCastShadow(false);
+		ISM->NumCustomDataFloats = 1;
+		ISM->SetupAttachment(RootComponent);
+		ISM->RegisterComponent();
+		VisualISMs[Visual] = ISM;
+	}
+	return VisualISMs[Visual];
+}
+
+void ANSWorkItemProxy::ShowEntry(const FNSWorkItemEntry& Entry)
+{
+	// 비주얼이 바뀌었으면(슬롯 재사용) 이전 인스턴스 반납
+	if (const FIntPoint* Ref = InstanceBySlot.Find(Entry.Slot); Ref && Ref->X != Entry.Visual)
+	{
+		HideEntry(Entry.Slot);
+	}
+
+	UInstancedStaticMeshComponent* ISM = GetVisualISM(Entry.Visual);
+	if (!ISM) return;   // 비주얼 정보가 아직 안 옴 → OnRep_Visuals에서 다시
+
+	const FTransform Xform(Entry.Rotation, Entry.Location, Entry.bMaterialized ? FVector::ZeroVector : FVector::OneVector);
+	int32 Instance;
+	if (const FIntPoint* Ref = InstanceBySlot.Find(Entry.Slot))
+	{
+		Instance = Ref->Y;
+		ISM->UpdateInstanceTransform(Instance, Xform, true, false);
+	}
+	else
+	{
+		TArray<int32>& Free = FreeInstances[Entry.Visual];
+		if (Free.Num() > 0)
+		{
+			Instance = Free.Pop(EAllowShrinking::No);
+			ISM->UpdateInstanceTransform(Instance, Xform, true, false);
+		}
+		else
+		{
+			Instance = ISM->AddInstance(Xform, true);
+		}
+		InstanceBySlot.Add(Entry.Slot, FIntPoint(Entry.Visual, Instance));
+	}
+	ISM->SetCustomDataValue(Instance, 0, 1.f - Entry.ProgressQ / 255.f, true);
+}
+
+void ANSWorkItemProxy::HideEntry(int32 Slot)
+{
+	FIntPoint Ref;
+	if (!InstanceBySlot.RemoveAndCopyValue(Slot, Ref)) return;
+
+	if (UInstancedStaticMeshComponent* ISM = VisualISMs.IsValidIndex(Ref.X) ? VisualISMs[Ref.X].Get() : nullptr)
+	{
+		FTransform Hidden;
+		ISM->GetInstanceTransform(Ref.Y, Hidden, true);
+		Hidden.SetScale3D(FVector::ZeroVector);
+		ISM->UpdateInstanceTransform(Ref.Y, Hidden, true, true);
+		FreeInstances[Ref.X].Add(Ref.Y);
+	}
+}
+
+void ANSWorkItemProxy::OnRep_Visuals()
+{
+	RefreshAll();
+}
+
+void ANSWorkItemProxy::RefreshAll()
+{
+	for (const FNSWorkItemEntry& E : Items.Items)
+	{
+		ShowEntry(E);
+	}
+}
@@ -0,0 +1,111 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "NSWorkItemProxy.generated.h"
+
+class ANSWorkItemProxy;
+class UInstancedStaticMeshComponent;
+
+// 클라로 보내는 항목 하나 (렌더링에 필요한 것만)
+USTRUCT()
+struct FNSWorkItemEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Slot = INDEX_NONE;
+	UPROPERTY() FVector_NetQuantize Location;
+	UPROPERTY() FRotator Rotation;
+	UPROPERTY() uint8 Visual = 0;       // ANSWorkItemProxy::Visuals 인덱스
+	UPROPERTY() uint8 ProgressQ = 0;    // 0~255, 인스턴스 페이드
+	UPROPERTY() bool bMaterialized = false; // 액터로 떠 있는 동안 인스턴스 숨김
+
+	void PostReplicatedAdd(const struct FNSWorkItemArray& Array);
+	void PostReplicatedChange(const struct FNSWorkItemArray& Array);
+	void PreReplicatedRemove(const struct FNSWorkItemArray& Array);
+};
+
+USTRUCT()
+struct FNSWorkItemArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<FNSWorkItemEntry> Items;
+
+	ANSWorkItemProxy* Owner = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FNSWorkItemEntry, FNSWorkItemArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FNSWorkItemArray> : public TStructOpsTypeTraitsBase2<FNSWorkItemArray>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
+// 메시+머티리얼 조합 하나 = 클라 ISM 컴포넌트 하나
+USTRUCT()
+struct FNSWorkItemVisual
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TObjectPtr<UStaticMesh> Mesh = nullptr;
+	UPROPERTY() TObjectPtr<UMaterialInterface> Material = nullptr;
+};
+
+/**
+ * 액터 없는 업무 항목(UNSWorkItemSubsystem)의 복제 창구 겸 클라 렌더러.
+ * 맵당 하나, 서버가 만들고 항목은 FastArray 델타로만 복제. 클라(리슨 서버 포함)는 비주얼별 ISM 인스턴스로 그린다.
+ * 인스턴스 커스텀 데이터 0번 = 페이드(1=그대로), AMemoryStain과 같은 머티리얼을 그대로 쓸 수 있음
+ */
+UCLASS(NotBlueprintable)
+class ANSWorkItemProxy : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ANSWorkItemProxy();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PostInitializeComponents() override;
+
+	// 서버: 항목 추가/갱신/제거 (리슨 서버면 로컬 인스턴스도 바로 반영)
+	uint8 FindOrAddVisual(UStaticMesh* Mesh, UMaterialInterface* Material);
+	void ServerAddItem(int32 Slot, const FTransform& Xform, uint8 Visual);
+	void ServerUpdateItem(int32 Slot, uint8 ProgressQ, bool bMaterialized);
+	void ServerRemoveItem(int32 Slot);
+
+	// FastArray 콜백
+	void ShowEntry(const FNSWorkItemEntry& Entry);
+	void HideEntry(int32 Slot);
+
+protected:
+	UPROPERTY(Replicated)
+	FNSWorkItemArray Items;
+
+	UPROPERTY(ReplicatedUsing = OnRep_Visuals)
+	TArray<FNSWorkItemVisual> Visuals;
+
+	UFUNCTION() void OnRep_Visuals();
+
+private:
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UInstancedStaticMeshComponent>> VisualISMs;
+
+	// 슬롯 → (비주얼, 인스턴스). 지운 인스턴스는 크기 0으로 두고 재사용 (ISM 인덱스 재배열 회피)
+	TMap<int32, FIntPoint> InstanceBySlot;
+	TArray<TArray<int32>> FreeInstances;
+
+	// 서버: 슬롯 → Items 인덱스
+	TMap<int32, int32> EntryBySlot;
+
+	bool IsRenderingNetMode() const { return GetNetMode() != NM_DedicatedServer; }
+	UInstancedStaticMeshComponent* GetVisualISM(int32 Visual);
+	void RefreshAll();
+};
@@ -0,0 +1,283 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSWorkItemSubsystem.h"
+#include "NSWorkItemProxy.h"
+#include "NSWorkPoolSubsystem.h"
+#include "MopTarget.h"
+#include "MemoryStain.h"
+#include "Engine/World.h"
+
+bool UNSWorkItemSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UNSWorkItemSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	if (UNSWorkPoolSubsystem* Pool = Collection.InitializeDependency<UNSWorkPoolSubsystem>())
+	{
+		WorkCompletedHandle = Pool->OnWorkCompleted.AddUObject(this, &UNSWorkItemSubsystem::HandleActorCompleted);
+	}
+}
+
+void UNSWorkItemSubsystem::Deinitialize()
+{
+	if (UNSWorkPoolSubsystem* Pool = GetWorld()->GetSubsystem<UNSWorkPoolSubsystem>())
+	{
+		Pool->OnWorkCompleted.Remove(WorkCompletedHandle);
+	}
+	SlotByActor.Reset();
+	Proxy = nullptr;
+	Super::Deinitialize();
+}
+
+ANSWorkItemProxy* UNSWorkItemSubsystem::GetProxy()
+{
+	if (!Proxy)
+	{
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		Params.ObjectFlags |= RF_Transient;
+		Proxy = GetWorld()->SpawnActor<ANSWorkItemProxy>(FVector::ZeroVector, FRotator::ZeroRotator, Params);
+	}
+	return Proxy;
+}
+
+FNSWorkItemHandle UNSWorkItemSubsystem::Add(FNSWorkTypeId Type, UClass* ActorClass, const FTransform& Xform, EStainType StainType,
+	UStaticMesh* Mesh, UMaterialInterface* Material)
+{
+	if (!ActorClass || GetWorld()->GetNetMode() == NM_Client) return FNSWorkItemHandle();
+
+	int32 Slot;
+	if (FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Slot = Locations.Num();
+		Locations.AddUninitialized();
+		Rotations.AddUninitialized();
+		Types.AddUninitialized();
+		StainTypes.AddUninitialized();
+		Progress.AddUninitialized();
+		States.Add(EWorkItemState::Free);
+		Serials.Add(0);
+		Users.AddUninitialized();
+		ActorClasses.AddDefaulted();
+		Materials.AddDefaulted();
+		Actors.AddDefaulted();
+	}
+
+	Locations[Slot] = Xform.GetLocation();
+	Rotations[Slot] = Xform.GetRotation();
+	Types[Slot] = Type;
+	StainTypes[Slot] = StainType;
+	Progress[Slot] = 0.f;
+	States[Slot] = EWorkItemState::Idle;
+	Users[Slot] = 0;
+	ActorClasses[Slot] = ActorClass;
+	Materials[Slot] = Material;
+	Actors[Slot] = nullptr;
+	++Serials[Slot];
+	++NumAlive;
+
+	if (Mesh)
+	{
+		ANSWorkItemProxy* P = GetProxy();
+		P->ServerAddItem(Slot, Xform, P->FindOrAddVisual(Mesh, Material));
+	}
+	return MakeHandle(Slot);
+}
+
+FNSWorkItemHandle UNSWorkItemSubsystem::MakeHandle(int32 Slot) const
+{
+	FNSWorkItemHandle H;
+	H.Slot = Slot;
+	H.Serial = Serials[Slot];
+	return H;
+}
+
+bool UNSWorkItemSubsystem::IsValid(FNSWorkItemHandle Item) const
+{
+	return States.IsValidIndex(Item.Slot) && States[Item.Slot] != EWorkItemState::Free && Serials[Item.Slot] == Item.Serial;
+}
+
+FVector UNSWorkItemSubsystem::GetLocation(FNSWorkItemHandle Item) const
+{
+	return IsValid(Item) ? Locations[Item.Slot] : FVector::ZeroVector;
+}
+
+float UNSWorkItemSubsystem::GetProgressByKey(uint32 Key) const
+{
+	const int32 Slot = int32(Key & 0x7fffffffu);
+	if (!IsWorkKey(Key) || !States.IsValidIndex(Slot) || States[Slot] == EWorkItemState::Free) return 0.f;
+
+	if (const AMemoryStain* Stain = Cast<AMemoryStain>(Actors[Slot].Get()))
+	{
+		return Stain->GetMopAlpha();
+	}
+	return Progress[Slot];
+}
+
+bool UNSWorkItemSubsystem::Remove(FNSWorkItemHandle Item)
+{
+	if (!IsValid(Item)) return false;
+
+	DetachActor(Item.Slot, true);
+	const FNSWorkTypeId Type = Types[Item.Slot];
+	FreeSlot(Item.Slot);
+	OnItemResolved.Broadcast(Item, Type, nullptr);
+	return true;
+}
+
+void UNSWorkItemSubsystem::RemoveType(FNSWorkTypeId Type)
+{
+	for (int32 Slot = 0; Slot < States.Num(); ++Slot)
+	{
+		if (States[Slot] != EWorkItemState::Free && Types[Slot] == Type) Remove(MakeHandle(Slot));
+	}
+}
+
+void UNSWorkItemSubsystem::FreeSlot(int32 Slot)
+{
+	States[Slot] = EWorkItemState::Free;
+	ActorClasses[Slot] = nullptr;
+	Materials[Slot] = nullptr;
+	FreeSlots.Add(Slot);
+	--NumAlive;
+	if (Proxy) Proxy->ServerRemoveItem(Slot);
+}
+
+bool UNSWorkItemSubsystem::MatchesInterface(int32 Slot, const UClass* Interface) const
+{
+	return !Interface || (ActorClasses[Slot] && ActorClasses[Slot]->ImplementsInterface(Interface));
+}
+
+FNSWorkItemHandle UNSWorkItemSubsystem::FindNearest(const FVector& Pos, float Radius, const UClass* Interface) const
+{
+	// 선형 스캔이지만 위치/상태 배열만 훑음 (상호작용 시작 때만 호출)
+	int32 Best = INDEX_NONE;
+	double BestSq = FMath::Square(double(Radius));
+	for (int32 Slot = 0; Slot < Locations.Num(); ++Slot)
+	{
+		if (States[Slot] != EWorkItemState::Idle) continue;
+		const double DSq = FVector::DistSquared(Locations[Slot], Pos);
+		if (DSq < BestSq && MatchesInterface(Slot, Interface)) { Best = Slot; BestSq = DSq; }
+	}
+	return Best == INDEX_NONE ? FNSWorkItemHandle() : MakeHandle(Best);
+}
+
+void UNSWorkItemSubsystem::FindWithin(const FVector& Pos, float Radius, const UClass* Interface, TArray<FNSWorkItemHandle>& Out) const
+{
+	const double RadiusSq = FMath::Square(double(Radius));
+	for (int32 Slot = 0; Slot < Locations.Num(); ++Slot)
+	{
+		if (States[Slot] != EWorkItemState::Idle) continue;
+		if (FVector::DistSquared(Locations[Slot], Pos) < RadiusSq && MatchesInterface(Slot, Interface)) Out.Add(MakeHandle(Slot));
+	}
+}
+
+AActor* UNSWorkItemSubsystem::AcquireActor(FNSWorkItemHandle Item, AActor* Owner)
+{
+	if (!IsValid(Item)) return nullptr;
+	const int32 Slot = Item.Slot;
+
+	if (AActor* Existing = Actors[Slot])
+	{
+		Users[Slot] = uint8(FMath::Min(Users[Slot] + 1, int32(MAX_uint8)));
+		return Existing;
+	}
+
+	UNSWorkPoolSubsystem* Pool = GetWorld()->GetSubsystem<UNSWorkPoolSubsystem>();
+	if (!Pool) return nullptr;
+
+	const FTransform Xform(Rotations[Slot], Locations[Slot]);
+	AActor* A = Pool->Acquire(ActorClasses[Slot], Xform, Owner, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!A) return nullptr;
+
+	IMopTarget::InitializeStainOn(A, StainTypes[Slot], Materials[Slot]);
+	if (AMemoryStain* Stain = Cast<AMemoryStain>(A))
+	{
+		Stain->RestoreMopProgress(Progress[Slot]);
+	}
+
+	Actors[Slot] = A;
+	Users[Slot] = 1;
+	States[Slot] = EWorkItemState::Materialized;
+	SlotByActor.Add(A, Slot);
+	A->OnDestroyed.AddUniqueDynamic(this, &UNSWorkItemSubsystem::HandleActorDestroyed);
+	PushState(Slot);
+	return A;
+}
+
+void UNSWorkItemSubsystem::ReleaseActor(AActor* Actor)
+{
+	const int32* SlotPtr = Actor ? SlotByActor.Find(Actor) : nullptr;
+	if (!SlotPtr) return;
+
+	const int32 Slot = *SlotPtr;
+	if (Users[Slot] > 1) { --Users[Slot]; return; }
+
+	DetachActor(Slot, true);
+	States[Slot] = EWorkItemState::Idle;
+	PushState(Slot);
+}
+
+FNSWorkItemHandle UNSWorkItemSubsystem::FindByActor(const AActor* Actor) const
+{
+	const int32* Slot = Actor ? SlotByActor.Find(Actor) : nullptr;
+	return Slot ? MakeHandle(*Slot) : FNSWorkItemHandle();
+}
+
+void UNSWorkItemSubsystem::DetachActor(int32 Slot, bool bReturnToPool)
+{
+	AActor* A = Actors[Slot];
+	Actors[Slot] = nullptr;
+	Users[Slot] = 0;
+	if (!A) return;
+
+	SlotByActor.Remove(A);
+	A->OnDestroyed.RemoveDynamic(this, &UNSWorkItemSubsystem::HandleActorDestroyed);
+
+	// 진행도 되돌려 받기 (다음에 다시 띄우면 이어서)
+	if (const AMemoryStain* Stain = Cast<AMemoryStain>(A))
+	{
+		Progress[Slot] = Stain->GetMopAlpha();
+	}
+
+	if (bReturnToPool)
+	{
+		if (UNSWorkPoolSubsystem* Pool = GetWorld()->GetSubsystem<UNSWorkPoolSubsystem>()) Pool->Release(A);
+	}
+}
+
+void UNSWorkItemSubsystem::PushState(int32 Slot)
+{
+	if (!Proxy) return;
+	const uint8 Q = uint8(FMath::Clamp(FMath::RoundToInt(Progress[Slot] * 255.f), 0, 255));
+	Proxy->ServerUpdateItem(Slot, Q, States[Slot] == EWorkItemState::Materialized);
+}
+
+void UNSWorkItemSubsystem::HandleActorDestroyed(AActor* DestroyedActor)
+{
+	int32 Slot;
+	if (!SlotByActor.RemoveAndCopyValue(DestroyedActor, Slot)) return;
+
+	// 상호작용 액터 파괴 = 항목 완료 (걸레질 끝/흡수)
+	const FNSWorkItemHandle Item = MakeHandle(Slot);
+	const FNSWorkTypeId Type = Types[Slot];
+	Actors[Slot] = nullptr;
+	Users[Slot] = 0;
+	FreeSlot(Slot);
+	OnItemResolved.Broadcast(Item, Type, DestroyedActor);
+}
+
+void UNSWorkItemSubsystem::HandleActorCompleted(AActor* Actor)
+{
+	if (!SlotByActor.Contains(Actor)) return;
+	Actor->OnDestroyed.RemoveDynamic(this, &UNSWorkItemSubsystem::HandleActorDestroyed);
+	HandleActorDestroyed(Actor);
+}
@@ -0,0 +1,120 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "NSTypes.h"
+#include "NSWorkItemSubsystem.generated.h"
+
+class ANSWorkItemProxy;
+
+// 액터 없는 업무 항목 핸들. 슬롯은 재사용되므로 Serial로 오래된 핸들을 거른다
+USTRUCT(BlueprintType)
+struct FNSWorkItemHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Slot = INDEX_NONE;
+	UPROPERTY() uint32 Serial = 0;
+
+	bool IsValid() const { return Slot != INDEX_NONE; }
+	bool operator==(const FNSWorkItemHandle& Other) const { return Slot == Other.Slot && Serial == Other.Serial; }
+};
+
+enum class EWorkItemState : uint8
+{
+	Free,
+	Idle,          // 인스턴스로만 보임
+	Materialized,  // 상호작용 중이라 액터로 떠 있음
+};
+
+// 서버: 항목이 사라짐. Actor는 상호작용 액터가 파괴(=완료)됐을 때만 유효
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnWorkItemResolved, FNSWorkItemHandle /*Item*/, FNSWorkTypeId /*Type*/, AActor* /*CompletedActor*/);
+
+/**
+ * 얼룩/파편 같은 단순 업무를 액터 대신 SoA 레코드(위치/타입/진행도/상태)로 들고 있는 서버 저장소.
+ * 클라는 ANSWorkItemProxy의 ISM 인스턴스로만 보고, 플레이어가 상호작용하는 항목만 AcquireActor로
+ * 풀 액터를 띄워 IMopTarget/IMemoryShardInteract를 그대로 쓴다. 액터가 파괴되면 완료, ReleaseActor면 진행도를 되돌려 받고 다시 인스턴스로.
+ */
+UCLASS()
+class UNSWorkItemSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// 서버: 항목 추가. Mesh가 없으면 클라에 안 보임(액터로만 상호작용)
+	FNSWorkItemHandle Add(FNSWorkTypeId Type, UClass* ActorClass, const FTransform& Xform, EStainType StainType,
+		UStaticMesh* Mesh, UMaterialInterface* Material);
+	// 서버: 완료 없이 제거 (라운드 정리). 떠 있는 액터는 풀로 반납
+	bool Remove(FNSWorkItemHandle Item);
+	void RemoveType(FNSWorkTypeId Type);
+
+	bool IsValid(FNSWorkItemHandle Item) const;
+	int32 Num() const { return NumAlive; }
+	FNSWorkTypeId GetType(FNSWorkItemHandle Item) const { return Types[Item.Slot]; }
+	FVector GetLocation(FNSWorkItemHandle Item) const;
+
+	// Pos에서 Radius 안의 가장 가까운 Idle 항목. Interface를 주면 그 인터페이스를 구현한 액터 클래스 항목만
+	FNSWorkItemHandle FindNearest(const FVector& Pos, float Radius, const UClass* Interface = nullptr) const;
+	void FindWithin(const FVector& Pos, float Radius, const UClass* Interface, TArray<FNSWorkItemHandle>& Out) const;
+
+	// 상호작용용 액터 띄우기 (이미 떠 있으면 그 액터, 사용자 수 +1)
+	AActor* AcquireActor(FNSWorkItemHandle Item, AActor* Owner = nullptr);
+	// 사용자 수 -1, 0이면 진행도를 항목에 되돌리고 풀로 반납. 항목 액터가 아니면 무시
+	void ReleaseActor(AActor* Actor);
+	FNSWorkItemHandle FindByActor(const AActor* Actor) const;
+
+	// 디렉터 레지스트리/점유 해시 키 (액터 UniqueID와 겹치지 않게 최상위 비트)
+	static uint32 WorkKey(FNSWorkItemHandle Item) { return 0x80000000u | uint32(Item.Slot); }
+	static bool IsWorkKey(uint32 Key) { return (Key & 0x80000000u) != 0; }
+	// 키로 진행도 조회 (떠 있으면 그 액터 기준). 없는 슬롯이면 0
+	float GetProgressByKey(uint32 Key) const;
+
+	FOnWorkItemResolved OnItemResolved;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+private:
+	// SoA (슬롯 인덱스)
+	TArray<FVector> Locations;
+	TArray<FQuat> Rotations;
+	TArray<FNSWorkTypeId> Types;
+	TArray<EStainType> StainTypes;
+	TArray<float> Progress;
+	TArray<EWorkItemState> States;
+	TArray<uint32> Serials;
+	TArray<uint8> Users;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UClass>> ActorClasses;
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UMaterialInterface>> Materials;
+	// 떠 있는 액터 (Materialized 슬롯만)
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AActor>> Actors;
+
+	TArray<int32> FreeSlots;
+	int32 NumAlive = 0;
+	TMap<TObjectKey<AActor>, int32> SlotByActor;
+
+	UPROPERTY(Transient)
+	TObjectPtr<ANSWorkItemProxy> Proxy;
+
+	ANSWorkItemProxy* GetProxy();
+	FNSWorkItemHandle MakeHandle(int32 Slot) const;
+	bool MatchesInterface(int32 Slot, const UClass* Interface) const;
+	void FreeSlot(int32 Slot);
+	void DetachActor(int32 Slot, bool bReturnToPool);
+	void PushState(int32 Slot);
+
+	UFUNCTION()
+	void HandleActorDestroyed(AActor* DestroyedActor);
+	// 풀 CompleteWork: 파괴와 같은 완료 처리 (반납은 풀이 함)
+	void HandleActorCompleted(AActor* Actor);
+	FDelegateHandle WorkCompletedHandle;
+};
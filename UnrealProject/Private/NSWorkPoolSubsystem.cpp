@@ -0,0 +1,181 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSWorkPoolSubsystem.h"
+#include "NSPooledActor.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+
+bool UNSWorkPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UNSWorkPoolSubsystem::Prewarm(UClass* Class, int32 Count, AActor* Owner)
+{
+	if (!Class || Count <= 0) return;
+
+	FPool& Pool = Pools.FindOrAdd(Class);
+	const int32 Need = Count - (Pool.Free.Num() + Pool.InUse.Num());
+	for (int32 i = 0; i < Need; ++i)
+	{
+		AActor* A = SpawnPooled(Class, FTransform::Identity, Owner, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+		if (!A) break;
+		Deactivate(A);
+		Pool.Free.Add(A);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[POOL] Prewarm %s free=%d"), *GetNameSafe(Class), Pool.Free.Num());
+}
+
+AActor* UNSWorkPoolSubsystem::Acquire(UClass* Class, const FTransform& Xform, AActor* Owner,
+	ESpawnActorCollisionHandlingMethod Collision)
+{
+	if (!Class) return nullptr;
+
+	FPool& Pool = Pools.FindOrAdd(Class);
+
+	// 반납된 것 중 살아있는 것 하나 꺼내기
+	while (Pool.Free.Num() > 0)
+	{
+		AActor* A = Pool.Free.Pop(EAllowShrinking::No).Get();
+		if (!IsValid(A)) continue;
+
+		Activate(A, Xform);
+		if (Owner) A->SetOwner(Owner);
+		Pool.InUse.Add(A);
+		Pool.Hits++;
+		return A;
+	}
+
+	AActor* A = SpawnPooled(Class, Xform, Owner, Collision);
+	if (!A) return nullptr;
+
+	Pool.InUse.Add(A);
+	Pool.Misses++;
+	UE_LOG(LogTemp, Verbose, TEXT("[POOL] Miss %s (hits=%d misses=%d)"), *GetNameSafe(Class), Pool.Hits, Pool.Misses);
+	return A;
+}
+
+AActor* UNSWorkPoolSubsystem::SpawnPooled(UClass* Class, const FTransform& Xform, AActor* Owner,
+	ESpawnActorCollisionHandlingMethod Collision)
+{
+	AActor* A = GetWorld()->SpawnActorDeferred<AActor>(Class, Xform, Owner, nullptr, Collision);
+	if (!A) return nullptr;
+	UGameplayStatics::FinishSpawningActor(A, Xform);
+
+	// 충돌 처리로 스폰이 취소됐을 수 있음
+	if (!IsValid(A)) return nullptr;
+
+	A->OnDestroyed.AddUniqueDynamic(this, &UNSWorkPoolSubsystem::HandlePooledActorDestroyed);
+	return A;
+}
+
+void UNSWorkPoolSubsystem::Release(AActor* Actor)
+{
+	if (!IsValid(Actor)) return;
+
+	FPool* Pool = Pools.Find(Actor->GetClass());
+	if (!Pool || Pool->InUse.Remove(Actor) == 0) return;
+
+	Deactivate(Actor);
+	Pool->Free.Add(Actor);
+}
+
+void UNSWorkPoolSubsystem::CompleteWork(AActor* Actor)
+{
+	if (!IsValid(Actor)) return;
+
+	const FPool* Pool = Pools.Find(Actor->GetClass());
+	if (!Pool || !Pool->InUse.Contains(Actor))
+	{
+		Actor->Destroy();
+		return;
+	}
+
+	OnWorkCompleted.Broadcast(Actor);
+	Release(Actor);
+}
+
+int32 UNSWorkPoolSubsystem::ReleaseAll(UClass* Class)
+{
+	FPool* Pool = Class ? Pools.Find(Class) : nullptr;
+	if (!Pool) return 0;
+
+	int32 Released = 0;
+	for (const TWeakObjectPtr<AActor>& W : Pool->InUse)
+	{
+		if (AActor* A = W.Get())
+		{
+			Deactivate(A);
+			Pool->Free.Add(A);
+			++Released;
+		}
+	}
+	Pool->InUse.Reset();
+	return Released;
+}
+
+void UNSWorkPoolSubsystem::Activate(AActor* Actor, const FTransform& Xform)
+{
+	// 휴면 해제 후 위치/표시/충돌/틱 복구
+	Actor->SetNetDormancy(DORM_Awake);
+	Actor->SetActorTransform(Xform, false, nullptr, ETeleportType::TeleportPhysics);
+	Actor->SetActorHiddenInGame(false);
+	Actor->SetActorEnableCollision(true);
+	if (Actor->PrimaryActorTick.bStartWithTickEnabled)
+	{
+		Actor->SetActorTickEnabled(true);
+	}
+	Actor->ForceNetUpdate();
+
+	// 게임플레이 상태(흡입/탑승 등)는 액터가 직접 초기화
+	INSPooledActor::NotifyAcquired(Actor);
+}
+
+void UNSWorkPoolSubsystem::Deactivate(AActor* Actor)
+{
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+	Actor->GetWorldTimerManager().ClearAllTimersForObject(Actor);
+	INSPooledActor::NotifyReturned(Actor);
+
+	// 숨김 상태를 한 번 보낸 뒤 휴면 → 채널은 유지, 복제 비용만 0
+	Actor->FlushNetDormancy();
+	Actor->SetNetDormancy(DORM_DormantAll);
+}
+
+void UNSWorkPoolSubsystem::HandlePooledActorDestroyed(AActor* DestroyedActor)
+{
+	if (FPool* Pool = Pools.Find(DestroyedActor->GetClass()))
+	{
+		if (Pool->InUse.Remove(DestroyedActor) > 0)
+		{
+			Pool->Lost++;
+		}
+		Pool->Free.Remove(DestroyedActor);
+	}
+}
+
+int32 UNSWorkPoolSubsystem::GetHits(UClass* Class) const
+{
+	const FPool* Pool = Class ? Pools.Find(Class) : nullptr;
+	return Pool ? Pool->Hits : 0;
+}
+
+int32 UNSWorkPoolSubsystem::GetMisses(UClass* Class) const
+{
+	const FPool* Pool = Class ? Pools.Find(Class) : nullptr;
+	return Pool ? Pool->Misses : 0;
+}
+
+void UNSWorkPoolSubsystem::LogStats() const
+{
+	for (const TPair<TObjectKey<UClass>, FPool>& It : Pools)
+	{
+		const FPool& P = It.Value;
+		UE_LOG(LogTemp, Log, TEXT("[POOL] %s hits=%d misses=%d lost=%d free=%d inUse=%d"),
+			*GetNameSafe(It.Key.ResolveObjectPtr()), P.Hits, P.Misses, P.Lost, P.Free.Num(), P.InUse.Num());
+	}
+}
@@ -0,0 +1,69 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "NSWorkPoolSubsystem.generated.h"
+
+// 서버: 풀 액터 업무가 완료됨 (Destroy 대신). 구독자가 집계한 뒤 풀로 반납된다
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPooledWorkCompleted, AActor* /*Actor*/);
+
+/**
+ * 디렉터가 스폰하는 업무 액터(얼룩/샤드/승객) 풀.
+ * Destroy 대신 숨김+비활성화 후 반납하고, 다음 스폰에서 재사용한다. (서버 전용)
+ * 액터 고유 상태 초기화는 INSPooledActor 훅으로 맡긴다.
+ */
+UCLASS()
+class UNSWorkPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// 맵 로드 시 미리 Count개 만들어 두기
+	void Prewarm(UClass* Class, int32 Count, AActor* Owner);
+
+	// 풀에서 꺼내 Xform 위치로 활성화. 풀이 비었으면 새로 스폰(miss)
+	AActor* Acquire(UClass* Class, const FTransform& Xform, AActor* Owner,
+		ESpawnActorCollisionHandlingMethod Collision = ESpawnActorCollisionHandlingMethod::Undefined);
+
+	// 숨김/비활성화 후 풀로 반납
+	void Release(AActor* Actor);
+
+	// 해당 클래스로 대여 중인 액터 전부 반납, 반납한 개수 반환
+	int32 ReleaseAll(UClass* Class);
+
+	// 업무 액터가 스스로 끝났을 때 Destroy 대신 호출: OnWorkCompleted 알림 후 반납.
+	// 풀에서 나온 액터가 아니면 예전처럼 Destroy (구독자는 OnDestroyed로 집계)
+	void CompleteWork(AActor* Actor);
+
+	FOnPooledWorkCompleted OnWorkCompleted;
+
+	int32 GetHits(UClass* Class) const;
+	int32 GetMisses(UClass* Class) const;
+
+	void LogStats() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FPool
+	{
+		TArray<TWeakObjectPtr<AActor>> Free;
+		TSet<TWeakObjectPtr<AActor>> InUse;
+		int32 Hits = 0;
+		int32 Misses = 0;
+		int32 Lost = 0;   // 대여 중 외부에서 Destroy된 수
+	};
+
+	TMap<TObjectKey<UClass>, FPool> Pools;
+
+	AActor* SpawnPooled(UClass* Class, const FTransform& Xform, AActor* Owner, ESpawnActorCollisionHandlingMethod Collision);
+	static void Activate(AActor* Actor, const FTransform& Xform);
+	static void Deactivate(AActor* Actor);
+
+	UFUNCTION()
+	void HandlePooledActorDestroyed(AActor* DestroyedActor);
+};
@@ -0,0 +1,82 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSWorkRegistry.h"
+#include "GameFramework/Actor.h"
+
+int32 FNSWorkRegistry::Register(AActor* Actor, FNSWorkTypeId Type, float Now, int32 Zone)
+{
+	check(Actor);
+	const int32 Handle = RegisterKey(Actor->GetUniqueID(), Type, Now, Zone);
+	Records[Handle].Actor = Actor;
+	return Handle;
+}
+
+int32 FNSWorkRegistry::RegisterKey(uint32 Key, FNSWorkTypeId Type, float Now, int32 Zone)
+{
+	UnregisterKey(Key);
+
+	FNSWorkRecord R;
+	R.ActorId = Key;
+	R.Type = Type;
+	R.SpawnedAt = Now;
+	R.Zone = Zone;
+
+	const int32 Handle = Records.Add(MoveTemp(R));
+	ByActorId.Add(Records[Handle].ActorId, Handle);
+	++Counts[int32(Type)];
+	return Handle;
+}
+
+bool FNSWorkRegistry::Unregister(const AActor* Actor)
+{
+	return Actor && UnregisterKey(Actor->GetUniqueID());
+}
+
+bool FNSWorkRegistry::UnregisterKey(uint32 Key)
+{
+	const int32 Handle = FindKey(Key);
+	if (Handle == INDEX_NONE) return false;
+	UnregisterAt(Handle);
+	return true;
+}
+
+void FNSWorkRegistry::UnregisterAt(int32 Handle)
+{
+	if (!Records.IsValidIndex(Handle)) return;
+
+	const FNSWorkRecord& R = Records[Handle];
+	ByActorId.Remove(R.ActorId);
+	--Counts[int32(R.Type)];
+	Records.RemoveAt(Handle);
+}
+
+void FNSWorkRegistry::Reset()
+{
+	Records.Reset();
+	ByActorId.Reset();
+	FMemory::Memzero(Counts);
+}
+
+int32 FNSWorkRegistry::Find(const AActor* Actor) const
+{
+	return Actor ? FindKey(Actor->GetUniqueID()) : INDEX_NONE;
+}
+
+int32 FNSWorkRegistry::FindKey(uint32 Key) const
+{
+	const int32* Handle = ByActorId.Find(Key);
+	return Handle ? *Handle : INDEX_NONE;
+}
+
+void FNSWorkRegistry::TakeType(FNSWorkTypeId Type, TArray<FNSWorkRecord>& Out)
+{
+	for (auto It = Records.CreateIterator(); It; ++It)
+	{
+		if (It->Type != Type) continue;
+		Out.Add(*It);
+		ByActorId.Remove(It->ActorId);
+		It.RemoveCurrent();
+	}
+	Counts[int32(Type)] = 0;
+}
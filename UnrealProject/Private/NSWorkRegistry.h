@@ -0,0 +1,52 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NSTypes.h"
+
+// 디렉터가 내보낸 업무 하나
+struct FNSWorkRecord
+{
+	TWeakObjectPtr<AActor> Actor;   // 액터 없는 항목(UNSWorkItemSubsystem)이면 비어 있음
+	uint32 ActorId = 0;             // 액터 UniqueID 또는 항목 키
+	FNSWorkTypeId Type = WorkTypeId(EWorkType::Stain);
+	float SpawnedAt = 0.f;     // 라운드 경과 시간 기준
+	int32 Zone = INDEX_NONE;   // 스폰 포인트 구역 (구역 균형용, 수리는 없음)
+};
+
+/**
+ * 디렉터 소유 업무 레지스트리. 핸들은 희소 배열 인덱스라 해제 전까지 안정적이고,
+ * 타입별 개수는 등록/해제 때 갱신해 조회가 O(1). 월드 검색(GetAllActorsOfClass) 없이 정리/평가에 사용.
+ */
+struct FNSWorkRegistry
+{
+	// 같은 액터(풀 재사용)가 이미 있으면 교체. 핸들 반환
+	int32 Register(AActor* Actor, FNSWorkTypeId Type, float Now, int32 Zone = INDEX_NONE);
+	bool Unregister(const AActor* Actor);
+	// 액터 없는 항목용: 액터 UniqueID와 겹치지 않는 키로 등록/해제
+	int32 RegisterKey(uint32 Key, FNSWorkTypeId Type, float Now, int32 Zone = INDEX_NONE);
+	bool UnregisterKey(uint32 Key);
+	void UnregisterAt(int32 Handle);
+	void Reset();
+
+	int32 Find(const AActor* Actor) const;
+	int32 FindKey(uint32 Key) const;
+	const FNSWorkRecord* Get(int32 Handle) const { return Records.IsValidIndex(Handle) ? &Records[Handle] : nullptr; }
+	int32 Count(FNSWorkTypeId Type) const { return Counts[int32(Type)]; }
+	int32 Num() const { return Records.Num(); }
+
+	// Type 항목만 떼어 내 반환 (정리용)
+	void TakeType(FNSWorkTypeId Type, TArray<FNSWorkRecord>& Out);
+
+	template<typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		for (const FNSWorkRecord& R : Records) Func(R);
+	}
+
+private:
+	TSparseArray<FNSWorkRecord> Records;
+	TMap<uint32, int32> ByActorId;
+	int32 Counts[MaxWorkTypes] = {};
+};
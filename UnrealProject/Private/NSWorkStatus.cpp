@@ -0,0 +1,10 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSWorkStatus.h"
+#include "NSGameState.h"
+
+void FNSWorkStatusArray::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	if (Owner) Owner->OnWorkStatusChanged.Broadcast();
+}
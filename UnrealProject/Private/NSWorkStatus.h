@@ -0,0 +1,54 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "NSTypes.h"
+#include "NSWorkStatus.generated.h"
+
+class ANSGameState;
+
+// 살아 있는 업무 하나 (HUD/미니맵용 요약). Id = 디렉터 레지스트리 키 (액터 UniqueID 또는 항목 키)
+USTRUCT()
+struct FNSWorkStatusEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 Id = 0;
+	// 타입 ID (디렉터 WorkTypes 인덱스, < MaxWorkTypes). UENUM은 최댓값 비트만 쓰므로 정의 에셋 타입이 잘리지 않게 uint8
+	UPROPERTY() uint8 TypeId = 0;
+	UPROPERTY() FVector_NetQuantize Location;
+	UPROPERTY() uint8 ProgressQ = 0;    // 0~255
+
+	FNSWorkTypeId GetType() const { return TypeId; }
+	float GetProgress() const { return ProgressQ / 255.f; }
+};
+
+/**
+ * 게임 스테이트가 복제하는 업무 현황 목록. 추가/진행/해제가 있을 때 바뀐 항목만 델타로 보냄.
+ * 순서는 보장하지 않음 (서버 제거가 RemoveAtSwap)
+ */
+USTRUCT()
+struct FNSWorkStatusArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<FNSWorkStatusEntry> Items;
+
+	ANSGameState* Owner = nullptr;
+
+	// 클라: 델타 하나 받을 때마다 한 번 (항목별 콜백 대신 HUD 갱신 알림만)
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FNSWorkStatusEntry, FNSWorkStatusArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FNSWorkStatusArray> : public TStructOpsTypeTraitsBase2<FNSWorkStatusArray>
+{
+	enum { WithNetDeltaSerializer = true };
+};
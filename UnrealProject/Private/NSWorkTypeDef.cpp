@@ -0,0 +1,32 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "NSWorkTypeDef.h"
+#include "NSGameState.h"
+#include "Engine/World.h"
+
+int32 UNSWorkTypeDef::GetQuota(ESpawnStage Stage) const
+{
+	switch (Stage)
+	{
+	case ESpawnStage::Early:   return EarlyQuota;
+	case ESpawnStage::Peak:    return PeakQuota;
+	case ESpawnStage::Cleanup: return CleanupQuota;
+	default:                   return 0;
+	}
+}
+
+void UNSWorkTypeDef::OnWorkCompleted_Implementation(AActor* WorkActor, ANSSpawnDirector* Director) const
+{
+	if (CompletionScore == 0 || !WorkActor) return;
+
+	if (ANSGameState* GS = WorkActor->GetWorld()->GetGameState<ANSGameState>())
+	{
+		GS->AddScore(CompletionScore);
+	}
+}
+
+FPrimaryAssetId UNSWorkTypeDef::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId(TEXT("NSWorkType"), GetFName());
+}
@@ -0,0 +1,100 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "NSTypes.h"
+#include "NSWorkTypeDef.generated.h"
+
+class ANSSpawnDirector;
+
+// 디렉터가 이 타입 이벤트를 실행하는 방법
+UENUM(BlueprintType)
+enum class EWorkSpawnMode : uint8
+{
+	PooledAtPoint,   // SpawnTag 포인트에 ActorClass를 풀에서 꺼내 배치
+	StainAtPoint,    // 위와 같되 포인트 마스크로 얼룩 타입을 정하고 머티리얼 초기화 (IMopTarget)
+	RepairPool,      // 맵에 배치된 RepairPoolTag 액터 중 유휴 하나를 고장냄 (타입당 하나만)
+};
+
+/**
+ * 업무 타입 하나 (승객/얼룩/수리/파편/...). 디렉터 WorkTypes 목록 인덱스가 타입 ID(FNSWorkTypeId 값)가 된다.
+ * 새 역할은 이 에셋을 만들어 목록에 넣는 것으로 끝 (디렉터 코드 수정 없음)
+ */
+UCLASS(BlueprintType, Blueprintable)
+class UNSWorkTypeDef : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// 로그/텔레메트리용 이름. 비우면 에셋 이름
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Work")
+	FName TypeName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Work")
+	EWorkSpawnMode SpawnMode = EWorkSpawnMode::PooledAtPoint;
+
+	// 스폰 포인트 태그 (RepairPool이면 미사용)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Work", meta = (EditCondition = "SpawnMode != EWorkSpawnMode::RepairPool"))
+	FName SpawnTag;
+
+	// 프리로드 후 풀에서 꺼내 씀 (RepairPool이면 미사용)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Work", meta = (EditCondition = "SpawnMode != EWorkSpawnMode::RepairPool"))
+	TSoftClassPtr<AActor> ActorClass;
+
+	// 남은 업무/평가에 세는지 (승객처럼 스폰만 하고 끝나는 타입은 false)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Work")
+	bool bCountsAsWork = true;
+
+	// 스테이지별 누적 상한 (라운드 시작부터 센 수와 비교)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Quota", meta = (ClampMin = "0"))
+	int32 EarlyQuota = 0;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Quota", meta = (ClampMin = "0"))
+	int32 PeakQuota = 0;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Quota", meta = (ClampMin = "0"))
+	int32 CleanupQuota = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Quota", meta = (ClampMin = "0.1"))
+	float CooldownSec = 5.f;
+
+	// 플레이어 근처 포인트 가중치를 낮추고, 디렉터가 시야 제약을 켰으면 보이는 포인트를 피함
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Placement")
+	bool bKeepAwayFromPlayers = true;
+	// 같은 타입끼리 최소 간격(cm). 0이면 디렉터 PointClearance만
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Placement", meta = (ClampMin = "0"))
+	float MinSameTypeSpacing = 0.f;
+	// 스폰 자리를 떠나는 타입(승객)은 이 시간 뒤 점유 해제. 0이면 사라질 때까지
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Placement", meta = (ClampMin = "0"))
+	float OccupancyHoldSec = 0.f;
+
+	// 켜면 액터 대신 UNSWorkItemSubsystem 항목으로 두고 클라는 ProxyMesh 인스턴스로 그림.
+	// 플레이어가 상호작용할 때만 ActorClass를 띄움 (얼룩/파편처럼 제자리에서 처리되는 타입용)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Actorless", meta = (EditCondition = "SpawnMode != EWorkSpawnMode::RepairPool"))
+	bool bActorless = false;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Actorless", meta = (EditCondition = "bActorless"))
+	TSoftObjectPtr<UStaticMesh> ProxyMesh;
+	// 얼룩(StainAtPoint)은 무시하고 디렉터의 타입별 기본 머티리얼 (띄운 액터와 같은 모습). 비우면 메시 기본 머티리얼
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Actorless", meta = (EditCondition = "bActorless"))
+	TSoftObjectPtr<UMaterialInterface> ProxyMaterial;
+
+	// 맵 로드 시 액터 풀에 미리 만들어 둘 개수
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pool", meta = (ClampMin = "0"))
+	int32 PrewarmCount = 0;
+
+	// 완료 시 디렉터가 주는 점수. 게임플레이 코드가 이미 점수를 주는 타입(얼룩/수리)은 0
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Completion")
+	int32 CompletionScore = 0;
+	// 스폰 시뮬레이터(-run=NSSpawnSim)용 평균 처리 시간
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Completion", meta = (ClampMin = "0"))
+	float SimClearSec = 5.f;
+
+	// 서버: 이 타입 업무가 완료됨 (액터 파괴/수리 완료). 기본은 CompletionScore 지급
+	UFUNCTION(BlueprintNativeEvent, Category = "Completion")
+	void OnWorkCompleted(AActor* WorkActor, ANSSpawnDirector* Director) const;
+
+	FName GetTypeName() const { return TypeName.IsNone() ? GetFName() : TypeName; }
+	int32 GetQuota(ESpawnStage Stage) const;
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+};
@@ -4,11 +4,13 @@
 #include "PassengerDummy.h"
 #include "Net/UnrealNetwork.h"
 #include "Components/StaticMeshComponent.h"
+#include "NSTypes.h"
 
 
 APassengerDummy::APassengerDummy()
 {
 	SetReplicateMovement(true);
+	SetNetCullDistanceSquared(FMath::Square(NSNet::PassengerCullDistance));
 
 	Mesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Mesh"));
 	SetRootComponent(Mesh);
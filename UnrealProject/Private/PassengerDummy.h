@@ -4,10 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "NSPooledActor.h"
 #include "PassengerDummy.generated.h"
 
+// 풀 재사용 승객. 탑승/이동 상태는 BP 자식이 OnAcquiredFromPool/OnReturnedToPool에서 초기화
 UCLASS()
-class APassengerDummy : public AActor
+class APassengerDummy : public AActor, public INSPooledActor
 {
 	GENERATED_BODY()
 	
@@ -21,7 +23,7 @@ protected:
 	virtual void BeginPlay() override;
 
 public:	
-	// 뼭 ̰  Ŷ Movement 
+	// 전용서버에서만 움직이게 할 거라 Movement 복제만
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out) const override;
 	
 };
@@ -16,6 +16,7 @@
 #include "StartRitualStatue.h"
 #include "NSPlayerController.h"
 #include "MopTarget.h"
+#include "NSWorkItemSubsystem.h"
 #include "MemoryShardInteract.h"
 #include "Kismet/KismetSystemLibrary.h"    
 #include "Kismet/GameplayStatics.h"
@@ -318,7 +319,7 @@ void APlayerCharacter::StartSprinting()
 {
 	if (!IsLocallyControlled()) return;
 
-	bIsSprinting = true;
+	NS_SET_DIRTY(APlayerCharacter, bIsSprinting, true);
 	UpdateMovementSpeedFromState();
 
 	if (!HasAuthority())
@@ -331,7 +332,7 @@ void APlayerCharacter::StopSprinting()
 {
 	if (!IsLocallyControlled()) return;
 
-	bIsSprinting = false;
+	NS_SET_DIRTY(APlayerCharacter, bIsSprinting, false);
 	UpdateMovementSpeedFromState();
 
 	if (!HasAuthority())
@@ -518,11 +519,22 @@ void APlayerCharacter::SetMovementInputEnabled(bool bIsEnabled)
 void APlayerCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(APlayerCharacter, bIsSprinting);
-	DOREPLIFETIME(APlayerCharacter, CurrentEquip);
-	DOREPLIFETIME(APlayerCharacter, CleanState);
-	DOREPLIFETIME(APlayerCharacter, bActionLocked);
-	DOREPLIFETIME(APlayerCharacter, CleaningTarget);
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(APlayerCharacter, bIsSprinting, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(APlayerCharacter, CurrentEquip, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(APlayerCharacter, CleanState, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(APlayerCharacter, bActionLocked, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(APlayerCharacter, CleaningTarget, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(APlayerCharacter, MopTarget, Params);
+}
+
+void APlayerCharacter::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+#if NS_VALIDATE_PUSH_MODEL
+	PushValidator.Validate(this, APlayerCharacter::StaticClass());
+#endif
 }
 
 // 상태->속도 적용(서버/클라 공용)
@@ -543,7 +555,7 @@ void APlayerCharacter::OnRep_IsSprinting()
 // 서버 RPC: 클라 입력을 서버에 요청
 void APlayerCharacter::ServerSetSprinting_Implementation(bool bNewIsSprinting)
 {
-	bIsSprinting = bNewIsSprinting;
+	NS_SET_DIRTY(APlayerCharacter, bIsSprinting, bNewIsSprinting);
 	UpdateMovementSpeedFromState();
 }
 
@@ -604,7 +616,7 @@ void APlayerCharacter::Server_SetEquip_Implementation(EEquipmentType NewEquip)
 	if (NewEquip == CurrentEquip) return; 
 
 	EEquipmentType Prev = CurrentEquip;
-	CurrentEquip = NewEquip;
+	NS_SET_DIRTY(APlayerCharacter, CurrentEquip, NewEquip);
 
 	ApplyEquipVisuals();
 	ApplyCurrentEquipOffset();
@@ -685,36 +697,27 @@ void APlayerCharacter::Server_BeginClean_Implementation()
 	if (CleanState != ECleanState::None || bActionLocked) return;
 	if (CurrentEquip != EEquipmentType::Mop) return;
 
-	AActor* Target = Server_FindMopTarget();
+	AActor* Target = Server_AcquireMopTarget(Server_FindMopTarget());
 	if (!Target) return;
 
 
 
-	MopTarget = Target;
-	if (Target && Target->GetClass()->ImplementsInterface(UMopTarget::StaticClass()))
-	{
-		IMopTarget::Execute_Server_BeginMop(Target, this);
-	}
+	NS_SET_DIRTY(APlayerCharacter, MopTarget, Target);
+	IMopTarget::BeginMopOn(Target, this);
 
-	CleanState = ECleanState::Mopping;
-	bActionLocked = true;
+	NS_SET_DIRTY(APlayerCharacter, CleanState, ECleanState::Mopping);
+	NS_SET_DIRTY(APlayerCharacter, bActionLocked, true);
 
 	// 이동/몽타주는 RepNotify/BP에서 처리해도 되고 여기서 해도 됨
 	OnRep_CleanState();
 
 	// 연출(애니/사운드)을 위해 StainType 전달
-	EStainType T = EStainType::None; // 권장: None 추가해서 미세팅 상태를 식별
-	if (Target && Target->GetClass()->ImplementsInterface(UMopTarget::StaticClass()))
-	{
-		T = IMopTarget::Execute_GetStainType(Target);
-	}
+	const EStainType T = IMopTarget::GetStainTypeOf(Target); // 미세팅이면 None
 
-	Multicast_MopStart(T);
+	SendCosmetic(ECharacterCosmetic::MopStart, nullptr, T);
 
 	UE_LOG(LogTemp, Log, TEXT("[MOP] Begin target=%s Type=%s"),
 		*GetNameSafe(Target), *UEnum::GetValueAsString(T));
-	UE_LOG(LogTemp, Log, TEXT("[MOP] Target=%s Type=%s"),
-		*GetNameSafe(MopTarget), *UEnum::GetValueAsString(IMopTarget::Execute_GetStainType(MopTarget)));
 	GetWorldTimerManager().SetTimer(MopTickHandle, this, &APlayerCharacter::Server_MopTick, 0.05f, true);
 	ForceNetUpdate();
 }
@@ -725,35 +728,36 @@ void APlayerCharacter::Server_EndClean_Implementation()
 
 	UE_LOG(LogTemp, Log, TEXT("[MOP] End"));
 
-	if (MopTarget && MopTarget->GetClass()->ImplementsInterface(UMopTarget::StaticClass()))
+	IMopTarget::EndMopOn(MopTarget);
+	if (UNSWorkItemSubsystem* Items = GetWorld()->GetSubsystem<UNSWorkItemSubsystem>())
 	{
-		IMopTarget::Execute_Server_EndMop(MopTarget);
+		Items->ReleaseActor(MopTarget);
 	}
-	MopTarget = nullptr;
+	NS_SET_DIRTY(APlayerCharacter, MopTarget, nullptr);
 
 	GetWorldTimerManager().ClearTimer(MopTickHandle);
 
-	CleanState = ECleanState::None;
-	bActionLocked = false;
+	NS_SET_DIRTY(APlayerCharacter, CleanState, ECleanState::None);
+	NS_SET_DIRTY(APlayerCharacter, bActionLocked, false);
 
 	OnRep_CleanState();
-	Multicast_MopStop();
+	SendCosmetic(ECharacterCosmetic::MopStop);
 	ForceNetUpdate();
 }
 
 void APlayerCharacter::Server_MopTick()
 {
-	if (CleanState != ECleanState::Mopping || !MopTarget)
+	// 풀로 반납된(다른 플레이어가 끝낸) 얼룩은 숨김 상태
+	if (CleanState != ECleanState::Mopping || !MopTarget || MopTarget->IsHidden())
 	{
 		UE_LOG(LogTemp, Log, TEXT("[MOP] Early end"));
 		Server_EndClean();
 		return;
 	}
 
-	bool bDone = false;
-	const bool bIntf = MopTarget->GetClass()->ImplementsInterface(UMopTarget::StaticClass());
-	if (bIntf) { bDone = IMopTarget::Execute_Server_MopAdvance(MopTarget, 0.05f); }
-	UE_LOG(LogTemp, Log, TEXT("[MOP] Tick target=%s intf=%d done=%d"), *GetNameSafe(MopTarget), bIntf, bDone);
+	// 네이티브 얼룩(AMemoryStain)은 VM을 거치지 않음
+	const bool bDone = IMopTarget::MopAdvanceOn(MopTarget, 0.05f);
+	UE_LOG(LogTemp, VeryVerbose, TEXT("[MOP] Tick target=%s done=%d"), *GetNameSafe(MopTarget), bDone);
 
 	if (bDone)
 	{
@@ -765,18 +769,56 @@ void APlayerCharacter::Server_MopTick()
 	}
 }
 
-void APlayerCharacter::Multicast_MopStart_Implementation(EStainType StainType)
+void APlayerCharacter::SendCosmetic(ECharacterCosmetic Event, AActor* Target, EStainType StainType)
 {
-	// 코스메틱(모든 클라) ⇒ 타입별 몽타주 + SFX
-	PlayMopCosmetics(StainType);
+	if (!HasAuthority()) return;
 
-	// BP에서 StainType으로 몽타주 분기(벽/바닥/오브젝트) – 기존 그래프 그대로
-	BP_OnMopStarted(StainType); // 없으면 생략
+	// 멀티캐스트는 거리와 상관없이 모든 연결로 가므로, 범위 안 PC에만 Client RPC
+	const AController* OwnerController = GetController();
+	const float RangeSq = FMath::Square(CosmeticRange);
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		ANSPlayerController* PC = Cast<ANSPlayerController>(It->Get());
+		if (!PC) continue;
+
+		if (PC != OwnerController && CosmeticRange > 0.f)
+		{
+			FVector ViewLoc;
+			FRotator ViewRot;
+			PC->GetPlayerViewPoint(ViewLoc, ViewRot);
+			if (FVector::DistSquared(ViewLoc, GetActorLocation()) > RangeSq) continue;
+		}
+		PC->Client_PlayCosmetic(this, Event, Target, StainType);
+	}
 }
 
-void APlayerCharacter::Multicast_MopStop_Implementation()
+void APlayerCharacter::PlayCosmetic(ECharacterCosmetic Event, AActor* Target, EStainType StainType)
 {
-	StopMopCosmetics();
+	// 흡입/수집은 서버가 이미 실행함 (리슨 호스트 중복 방지)
+	const bool bShardEvent = Event == ECharacterCosmetic::StartSuction
+		|| Event == ECharacterCosmetic::StopSuction
+		|| Event == ECharacterCosmetic::Collect;
+	if (bShardEvent && (HasAuthority() || !IsValid(Target)
+		|| !Target->GetClass()->ImplementsInterface(UMemoryShardInteract::StaticClass())))
+	{
+		return;
+	}
+
+	switch (Event)
+	{
+	case ECharacterCosmetic::MopStart:
+		// 코스메틱(범위 안 클라) ⇒ 타입별 몽타주 + SFX
+		PlayMopCosmetics(StainType);
+		// BP에서 StainType으로 몽타주 분기(벽/바닥/오브젝트) – 기존 그래프 그대로
+		BP_OnMopStarted(StainType);
+		break;
+	case ECharacterCosmetic::MopStop:      StopMopCosmetics(); break;
+	case ECharacterCosmetic::VacuumStart:  PlayVacuumCosmetics(true); break;
+	case ECharacterCosmetic::VacuumStop:   PlayVacuumCosmetics(false); break;
+	case ECharacterCosmetic::StartSuction: IMemoryShardInteract::Execute_StartSuction(Target, this); break;
+	case ECharacterCosmetic::StopSuction:  IMemoryShardInteract::Execute_StopSuction(Target); break;
+	case ECharacterCosmetic::Collect:      IMemoryShardInteract::Execute_Collect(Target, this); break;
+	}
 }
 
 void APlayerCharacter::OnRep_CleanState()
@@ -804,13 +846,30 @@ AActor* APlayerCharacter::Server_FindMopTarget() const
 	AActor* Best = nullptr; float BestD2 = TNumericLimits<float>::Max();
 	for (AActor* A : OutActors)
 	{
-		if (!A || !A->GetClass()->ImplementsInterface(UMopTarget::StaticClass())) continue;
+		if (!IMopTarget::IsMopTarget(A)) continue;
 		const float D2 = FVector::DistSquared(A->GetActorLocation(), Center);
 		if (D2 < BestD2) { Best = A; BestD2 = D2; }
 	}
 	return Best;
 }
 
+AActor* APlayerCharacter::Server_AcquireMopTarget(AActor* Target)
+{
+	UNSWorkItemSubsystem* Items = GetWorld()->GetSubsystem<UNSWorkItemSubsystem>();
+	if (!Items) return Target;
+
+	if (Target)
+	{
+		// 다른 플레이어가 이미 띄운 항목 액터면 같이 사용
+		const FNSWorkItemHandle Item = Items->FindByActor(Target);
+		if (Item.IsValid()) Items->AcquireActor(Item);
+		return Target;
+	}
+
+	const FVector Center = GetActorLocation() + GetActorForwardVector() * 120.f;
+	return Items->AcquireActor(Items->FindNearest(Center, 80.f, UMopTarget::StaticClass()));
+}
+
 void APlayerCharacter::PlayMopCosmetics(EStainType T)
 {
 	if (GetNetMode() == NM_DedicatedServer) return;
@@ -862,7 +921,7 @@ void APlayerCharacter::OnInteractOverlapBegin(
 	int32 /*OtherBodyIndex*/, bool /*bFromSweep*/, const FHitResult& /*Sweep*/)
 {
 	if (!Other) return;
-	if (!Other->GetClass()->ImplementsInterface(UMopTarget::StaticClass())) return;
+	if (!IMopTarget::IsMopTarget(Other)) return;
 
 	OverlappingMopTargets.AddUnique(Other);
 	ClientMopCandidate = PickNearestMopCandidate();
@@ -900,7 +959,7 @@ void APlayerCharacter::Server_BeginCleanWithTarget_Implementation(AActor* InTarg
 	AActor* Target = nullptr;
 
 	// 빠른 재검증: 인터페이스 + 실제 오버랩(or 근접) 확인
-	if (InTarget && InTarget->GetClass()->ImplementsInterface(UMopTarget::StaticClass()))
+	if (IMopTarget::IsMopTarget(InTarget))
 	{
 		const bool bOverlapOK =
 			(InteractionCollision && InteractionCollision->IsOverlappingActor(InTarget)) ||
@@ -912,24 +971,25 @@ void APlayerCharacter::Server_BeginCleanWithTarget_Implementation(AActor* InTarg
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("[MOP] Target=%s Type=%s"),
-		*GetNameSafe(Target), *UEnum::GetValueAsString(IMopTarget::Execute_GetStainType(Target)));
+		*GetNameSafe(Target), *UEnum::GetValueAsString(IMopTarget::GetStainTypeOf(Target)));
 
 	// 실패 시 서버가 다시 찾기 (안전장치)
 	if (!Target) Target = Server_FindMopTarget();
+	Target = Server_AcquireMopTarget(Target);
 	if (!Target) return;
 
-	MopTarget = Target;
+	NS_SET_DIRTY(APlayerCharacter, MopTarget, Target);
 
 	// 타깃에게 걸레질 시작 알림
-	IMopTarget::Execute_Server_BeginMop(Target, this);
+	IMopTarget::BeginMopOn(Target, this);
 
-	CleanState = ECleanState::Mopping;
-	bActionLocked = true;
+	NS_SET_DIRTY(APlayerCharacter, CleanState, ECleanState::Mopping);
+	NS_SET_DIRTY(APlayerCharacter, bActionLocked, true);
 	OnRep_CleanState(); // 로컬 이동잠금 등 반영
 
 	// 타입별 연출 브로드캐스트
-	EStainType T = IMopTarget::Execute_GetStainType(Target);
-	Multicast_MopStart(T);
+	const EStainType T = IMopTarget::GetStainTypeOf(Target);
+	SendCosmetic(ECharacterCosmetic::MopStart, nullptr, T);
 
 	// 서버 틱
 	const float Rate = 0.05f;
@@ -943,10 +1003,10 @@ void APlayerCharacter::Server_BeginVacuum_Implementation()
 	if (CleanState != ECleanState::None || bActionLocked) return;
 	if (CurrentEquip != EEquipmentType::Vacuum) return;
 
-	CleanState = ECleanState::Vacuuming;
-	bActionLocked = true;
+	NS_SET_DIRTY(APlayerCharacter, CleanState, ECleanState::Vacuuming);
+	NS_SET_DIRTY(APlayerCharacter, bActionLocked, true);
 
-	Multicast_VacuumStart();     
+	SendCosmetic(ECharacterCosmetic::VacuumStart);
 
 	if (VacuumCollision)
 	{
@@ -964,27 +1024,29 @@ void APlayerCharacter::Server_EndVacuum_Implementation()
 {
 	if (CleanState != ECleanState::Vacuuming) return;
 
-	CleanState = ECleanState::None;
-	bActionLocked = false;
+	NS_SET_DIRTY(APlayerCharacter, CleanState, ECleanState::None);
+	NS_SET_DIRTY(APlayerCharacter, bActionLocked, false);
 
 	GetWorldTimerManager().ClearTimer(VacuumTickHandle);
 
 	// 흡수 중 표시된 샤드 모두 StopSuction
+	UNSWorkItemSubsystem* Items = GetWorld()->GetSubsystem<UNSWorkItemSubsystem>();
 	for (auto W : ActiveVacuumSet)
 		if (AActor* A = W.Get())
 		{
 			if (A->GetClass()->ImplementsInterface(UMemoryShardInteract::StaticClass()))
 			{
 				IMemoryShardInteract::Execute_StopSuction(A);
-				Multicast_StopSuction(A);
+				SendCosmetic(ECharacterCosmetic::StopSuction, A);
 			}
+			if (Items) Items->ReleaseActor(A);   // 액터 없는 항목이었으면 다시 인스턴스로
 		}
 	ActiveVacuumSet.Empty();
 
 	if (VacuumCollision)
 		VacuumCollision->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
-	Multicast_VacuumStop();
+	SendCosmetic(ECharacterCosmetic::VacuumStop);
 	ForceNetUpdate();
 }
 
@@ -992,6 +1054,22 @@ void APlayerCharacter::Server_VacuumTick()
 {
 	if (!HasAuthority() || CleanState != ECleanState::Vacuuming) return;
 
+	// 흡입 범위 안의 액터 없는 파편 항목은 액터로 띄워 기존 흡입 경로에 태움
+	if (UNSWorkItemSubsystem* Items = GetWorld()->GetSubsystem<UNSWorkItemSubsystem>())
+	{
+		TArray<FNSWorkItemHandle> Near;
+		const FVector Center = VacuumCollision ? VacuumCollision->GetComponentLocation() : GetActorLocation();
+		Items->FindWithin(Center, VacuumOverlapRadius, UMemoryShardInteract::StaticClass(), Near);
+		for (const FNSWorkItemHandle& Item : Near)
+		{
+			AActor* Shard = Items->AcquireActor(Item);
+			if (!Shard) continue;
+			ActiveVacuumSet.Add(Shard);
+			IMemoryShardInteract::Execute_StartSuction(Shard, this);
+			SendCosmetic(ECharacterCosmetic::StartSuction, Shard);
+		}
+	}
+
 	TArray<TWeakObjectPtr<AActor>> ToRemove;
 
 	for (auto W : ActiveVacuumSet)
@@ -1004,7 +1082,7 @@ void APlayerCharacter::Server_VacuumTick()
 		{
 			// 서버에서 실제 Collect 실행
 			IMemoryShardInteract::Execute_Collect(A, this);
-			Multicast_Collect(A);
+			SendCosmetic(ECharacterCosmetic::Collect, A);
 			ToRemove.Add(W);
 		}
 	}
@@ -1013,16 +1091,6 @@ void APlayerCharacter::Server_VacuumTick()
 		ActiveVacuumSet.Remove(W);
 }
 
-void APlayerCharacter::Multicast_VacuumStart_Implementation()
-{
-	PlayVacuumCosmetics(true);
-}
-
-void APlayerCharacter::Multicast_VacuumStop_Implementation()
-{
-	PlayVacuumCosmetics(false);
-}
-
 void APlayerCharacter::PlayVacuumCosmetics(bool bStart)
 {
 	if (GetNetMode() == NM_DedicatedServer) return;
@@ -1069,7 +1137,7 @@ void APlayerCharacter::OnVacuumOverlapBegin(UPrimitiveComponent* OverlappedComp,
 
 	// 서버 로직 + 코스메틱 동기화
 	IMemoryShardInteract::Execute_StartSuction(Other, this);
-	Multicast_StartSuction(Other);
+	SendCosmetic(ECharacterCosmetic::StartSuction, Other);
 }
 
 void APlayerCharacter::OnVacuumOverlapEnd(UPrimitiveComponent* OverlappedComp, AActor* Other,
@@ -1087,26 +1155,5 @@ void APlayerCharacter::OnVacuumOverlapEnd(UPrimitiveComponent* OverlappedComp, A
 	{
 		IMemoryShardInteract::Execute_StopSuction(Other);
 	}
-	Multicast_StopSuction(Other);
-}
-
-void APlayerCharacter::Multicast_StartSuction_Implementation(AActor* Shard)
-{
-	if (HasAuthority()) return;
-	if (IsValid(Shard) && Shard->GetClass()->ImplementsInterface(UMemoryShardInteract::StaticClass()))
-		IMemoryShardInteract::Execute_StartSuction(Shard, this);
+	SendCosmetic(ECharacterCosmetic::StopSuction, Other);
 }
-
-void APlayerCharacter::Multicast_StopSuction_Implementation(AActor* Shard)
-{
-	if (HasAuthority()) return;
-	if (IsValid(Shard) && Shard->GetClass()->ImplementsInterface(UMemoryShardInteract::StaticClass()))
-		IMemoryShardInteract::Execute_StopSuction(Shard);
-}
-
-void APlayerCharacter::Multicast_Collect_Implementation(AActor* Shard)
-{
-	if (HasAuthority()) return;
-	if (IsValid(Shard) && Shard->GetClass()->ImplementsInterface(UMemoryShardInteract::StaticClass()))
-		IMemoryShardInteract::Execute_Collect(Shard, this);
-}
\ No newline at end of file
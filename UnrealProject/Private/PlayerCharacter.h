@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "NSTypes.h"
+#include "NSPushModel.h"
 #include "Sound/SoundBase.h"
 #include "Components/AudioComponent.h"
 #include "PlayerCharacter.generated.h"
@@ -62,10 +63,18 @@ public:
 
 	// 서버 내부 헬퍼
 	AActor* Server_FindMopTarget() const;
+	// 액터 없는 업무 항목이면 사용자 수 +1 (EndClean에서 반납). Target이 없으면 근처 얼룩 항목을 액터로 띄움
+	AActor* Server_AcquireMopTarget(AActor* Target);
 	void    Server_MopTick();
 
-	UFUNCTION(NetMulticast, Unreliable) void Multicast_MopStart(EStainType StainType);
-	UFUNCTION(NetMulticast, Unreliable) void Multicast_MopStop();
+	// 코스메틱(걸레/청소기/흡입)은 멀티캐스트 대신 CosmeticRange 안의 연결에만 보냄.
+	// 서버가 각 PC의 Client_PlayCosmetic으로 전달 (소유자는 항상 포함, 0이면 전원)
+	UPROPERTY(EditAnywhere, Category = "Net", meta = (ClampMin = "0"))
+	float CosmeticRange = NSNet::CosmeticRange;
+
+	void SendCosmetic(ECharacterCosmetic Event, AActor* Target = nullptr, EStainType StainType = EStainType::None);
+	// 클라(리슨 호스트 포함): ANSPlayerController::Client_PlayCosmetic에서 호출
+	void PlayCosmetic(ECharacterCosmetic Event, AActor* Target, EStainType StainType);
 
 	UFUNCTION(BlueprintImplementableEvent, Category = "Clean")
 	void BP_OnMopStarted(EStainType StainType);
@@ -145,14 +154,6 @@ protected:
 	// 서버 RPC
 	UFUNCTION(Server, Reliable) void Server_EndVacuum();
 
-	UFUNCTION(NetMulticast, Unreliable) void Multicast_StartSuction(AActor* Shard);
-	UFUNCTION(NetMulticast, Unreliable) void Multicast_StopSuction(AActor* Shard);
-	UFUNCTION(NetMulticast, Unreliable) void Multicast_Collect(AActor* Shard);
-
-	// 멀티캐스트(코스메틱)
-	UFUNCTION(NetMulticast, Unreliable) void Multicast_VacuumStart();
-	UFUNCTION(NetMulticast, Unreliable) void Multicast_VacuumStop();
-
 	// 헬퍼
 	void PlayVacuumCosmetics(bool bStart);
 
@@ -319,8 +320,9 @@ protected:
 	// 상태에 따라 실제 이동 속도 적용(서버/클라 공용)
 	void UpdateMovementSpeedFromState();
 
-	// 복제 등록
+	// 복제 등록 (전부 푸시 모델: 서버에서 바꿀 때 NS_SET_DIRTY/NS_MARK_DIRTY 필수)
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Interact")
 	float InteractDistance = 350.f;
@@ -334,4 +336,9 @@ protected:
 
 	UPROPERTY()
 	TWeakObjectPtr<class AInteractiveActor> CurrentInteractable;
+
+#if NS_VALIDATE_PUSH_MODEL
+	FNSPushModelValidator PushValidator;
+	friend class FNSPushModelTest;   // Tests/NSPushModelTest.cpp
+#endif
 };
@@ -16,9 +16,9 @@ class AStartRitualStatue : public AInteractiveActor
 	
 public:
 	UFUNCTION(BlueprintCallable)
-	void RequestToggleReady(bool bReady); //  ȣ
+	void RequestToggleReady(bool bReady); // 위젯에서 호출
 
-	// г ʱȭ  (BP ε)
+	// 패널 초기화 훅 (BP에서 바인딩)
 	UFUNCTION(BlueprintImplementableEvent)
 	void BP_OnReadyStateChanged(int32 ReadyCount, int32 TotalPlayers);
 	
@@ -0,0 +1,140 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+#include "NSPushModel.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && NS_VALIDATE_PUSH_MODEL
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "NSGameState.h"
+#include "InteractiveActor.h"
+#include "PlayerCharacter.h"
+#include "MemoryStain.h"
+
+/**
+ * 푸시 모델 누락 검사. 서버 쪽 Set/Add/Server_ 변경 경로를 실제 인스턴스에서 한 번씩 밟고,
+ * 매 단계마다 PreReplication과 같은 검증기를 돌려 dirty 표시 없이 바뀐 복제 속성이 없는지 확인한다.
+ * 새 복제 속성/변경 경로를 추가하면 여기에도 단계를 추가할 것.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSPushModelTest, "NowhereStation.Net.PushModel.MutationsMarkDirty",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FNSPushModelTest::RunTest(const FString& Parameters)
+{
+	// 검증기가 꺼져 있으면 아무것도 보고하지 않아 테스트가 무의미해짐
+	IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("net.NS.ValidatePushModel"));
+	const int32 PrevCVar = CVar ? CVar->GetInt() : 1;
+	if (CVar) CVar->Set(1, ECVF_SetByCode);
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, /*bInformEngineOfWorld*/false);
+	FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+	Context.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	ANSGameState* GS = World->SpawnActor<ANSGameState>(Params);
+	AInteractiveActor* Repairable = World->SpawnActor<AInteractiveActor>(FVector(200.f, 0.f, 0.f), FRotator::ZeroRotator, Params);
+	APlayerCharacter* Char = World->SpawnActor<APlayerCharacter>(FVector::ZeroVector, FRotator::ZeroRotator, Params);
+	APlayerController* PC = World->SpawnActor<APlayerController>(Params);
+	AMemoryStain* Stain = World->SpawnActor<AMemoryStain>(FVector(50.f, 0.f, 0.f), FRotator::ZeroRotator, Params);
+
+	// 액터 EndPlay와 월드 서브시스템(풀/업무 항목) 정리까지 돌려 다음 테스트로 상태가 새지 않게
+	auto TearDown = [&]()
+	{
+		World->BeginTearingDown();
+		World->CleanupWorld();
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		if (CVar) CVar->Set(PrevCVar, ECVF_SetByCode);
+	};
+
+	if (!TestTrue(TEXT("spawned"), GS && Repairable && Char && PC && Stain))
+	{
+		TearDown();
+		return false;
+	}
+	PC->Possess(Char);
+
+	// 세 클래스의 검증기를 PreReplication과 똑같이 한 번씩 (첫 호출은 스냅샷)
+	auto Check = [&](const TCHAR* Step)
+	{
+		int32 Reports = 0;
+		Reports += GS->PushValidator.Validate(GS, ANSGameState::StaticClass());
+		Reports += Repairable->PushValidator.Validate(Repairable, AInteractiveActor::StaticClass());
+		Reports += Char->PushValidator.Validate(Char, APlayerCharacter::StaticClass());
+		TestEqual(FString::Printf(TEXT("%s: properties changed without NS_MARK_DIRTY"), Step), Reports, 0);
+	};
+	Check(TEXT("Snapshot"));
+
+	// --- GameState ---
+	GS->SetPhase(EGamePhase::Starting);                 Check(TEXT("SetPhase"));
+	GS->SetReadyCount(2);                               Check(TEXT("SetReadyCount"));
+	GS->SetTotalPlayers(4);                             Check(TEXT("SetTotalPlayers"));
+	GS->SetReadyLocked(true);                           Check(TEXT("SetReadyLocked"));
+	GS->SetStartCountdownDeadline(5.f);                 Check(TEXT("SetStartCountdownDeadline"));
+	GS->SetPhase(EGamePhase::InProgress);
+	GS->SetStartCountdownDeadline(0.f);                 Check(TEXT("SetStartCountdownDeadline(0)"));
+	GS->SetWorkDeadline(600.f);                         Check(TEXT("SetWorkDeadline"));
+	GS->SetSpawnStage(ESpawnStage::Peak);               Check(TEXT("SetSpawnStage"));
+	GS->SetDay(2);                                      Check(TEXT("SetDay"));
+	GS->SetReputation(3);                               Check(TEXT("SetReputation"));
+	GS->AddScore(5);                                    Check(TEXT("AddScore"));
+	GS->SetDayScore(0);                                 Check(TEXT("SetDayScore"));
+	GS->AddMemoryShard(3);                              Check(TEXT("AddMemoryShard"));
+	GS->AddWorkStatus(1, WorkTypeId(EWorkType::Stain), FVector(100.f, 0.f, 0.f));
+	GS->SetWorkStatusProgress(1, 0.5f);
+	GS->RemoveWorkStatus(1);                            Check(TEXT("WorkStatus"));
+
+	// --- 수리 대상: 시작 → 프롬프트 성공/실패 → 중단 → 재시작 → 완료 ---
+	Repairable->SetIsBroken(false);                     Check(TEXT("SetIsBroken(false)"));
+	Repairable->SetIsBroken(true);                      Check(TEXT("SetIsBroken(true)"));
+	Char->Server_TryStartRepair_Implementation(Repairable);
+	TestTrue(TEXT("repair started"), Repairable->IsInQTEMode());
+	Check(TEXT("Server_RequestStartRepair"));
+
+	Repairable->IssuePrompt();
+	Repairable->Server_SubmitQTEInput_Implementation(Repairable->CurrentPromptIndex, Repairable->CurrentPromptSeq);
+	Check(TEXT("Server_SubmitQTEInput(success)"));
+	Repairable->IssuePrompt();
+	Repairable->Server_SubmitQTEInput_Implementation(FQTEPromptMsg::NoKey, Repairable->CurrentPromptSeq);
+	Check(TEXT("Server_SubmitQTEInput(fail)"));
+
+	Char->Server_TryStopRepair_Implementation(Repairable);
+	Check(TEXT("Server_StopRepair"));
+
+	Char->Server_TryStartRepair_Implementation(Repairable);
+	for (int32 i = 0; i < 16 && Repairable->IsInQTEMode(); ++i)
+	{
+		Repairable->IssuePrompt();
+		Repairable->Server_SubmitQTEInput_Implementation(Repairable->CurrentPromptIndex, Repairable->CurrentPromptSeq);
+	}
+	TestFalse(TEXT("repair completed"), Repairable->IsBroken());
+	Check(TEXT("CompleteRepair"));
+
+	// --- 캐릭터 ---
+	Char->ServerSetSprinting_Implementation(true);      Check(TEXT("ServerSetSprinting(true)"));
+	Char->ServerSetSprinting_Implementation(false);     Check(TEXT("ServerSetSprinting(false)"));
+	Char->Server_SetEquip_Implementation(EEquipmentType::Vacuum);
+	Check(TEXT("Server_SetEquip(Vacuum)"));
+	Char->Server_BeginVacuum_Implementation();          Check(TEXT("Server_BeginVacuum"));
+	Char->Server_EndVacuum_Implementation();            Check(TEXT("Server_EndVacuum"));
+	Char->Server_SetEquip_Implementation(EEquipmentType::Mop);
+	Check(TEXT("Server_SetEquip(Mop)"));
+	Char->Server_BeginCleanWithTarget_Implementation(Stain);
+	TestTrue(TEXT("mopping"), Char->CleanState == ECleanState::Mopping);
+	Check(TEXT("Server_BeginCleanWithTarget"));
+	Char->Server_EndClean_Implementation();             Check(TEXT("Server_EndClean"));
+	Char->Server_BeginClean_Implementation();           Check(TEXT("Server_BeginClean"));
+	Char->Server_EndClean_Implementation();             Check(TEXT("Server_EndClean(after BeginClean)"));
+
+	TearDown();
+	return true;
+}
+
+#endif
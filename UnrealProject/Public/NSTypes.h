@@ -1,4 +1,4 @@
-#pragma once
+﻿#pragma once
 #include "CoreMinimal.h"
 #include "NSTypes.generated.h"
 
@@ -25,4 +25,47 @@ enum class EStainType : uint8
     Wall   UMETA(DisplayName = "Wall"),
     Object UMETA(DisplayName = "Object"),
     Floor  UMETA(DisplayName = "Floor"),
-};
\ No newline at end of file
+};
+
+// 업무 타입 ID = 디렉터 WorkTypes 목록(UNSWorkTypeDef) 인덱스. 정의 에셋으로 추가한 타입도 이 ID로만 다룸
+using FNSWorkTypeId = uint8;
+
+// 목록이 비었을 때 디렉터가 만드는 기본 4종의 ID (그 외 ID는 열거값이 아님)
+UENUM(BlueprintType)
+enum class EWorkType : uint8
+{
+    Passenger,
+    Stain,
+    Repair,
+    Shard,
+    MAX UMETA(Hidden)
+};
+
+constexpr FNSWorkTypeId WorkTypeId(EWorkType Type) { return FNSWorkTypeId(Type); }
+
+// 업무 타입 상한 (점유 해시 타입 마스크가 32비트)
+static constexpr int32 MaxWorkTypes = 32;
+
+// 연결별로 골라 보내는 캐릭터 연출 (APlayerCharacter::SendCosmetic)
+UENUM()
+enum class ECharacterCosmetic : uint8
+{
+    MopStart,
+    MopStop,
+    VacuumStart,
+    VacuumStop,
+    StartSuction,
+    StopSuction,
+    Collect
+};
+
+// 역 액터 네트 관련성 거리(cm), NetCullDistance로 설정. 레거시 관련성 검사는 항상 사용하고,
+// Iris에서는 Config/DefaultEngine.ini에서 Spatial 필터에 배정한 클래스만 이 거리로 컬링됨
+namespace NSNet
+{
+    static constexpr float WorkCullDistance = 5000.f;       // 얼룩, 파편, 잔해
+    static constexpr float RepairCullDistance = 8000.f;     // 수리 대상 (우선순위도 높임)
+    static constexpr float PassengerCullDistance = 6000.f;
+    static constexpr float PortalCullDistance = 12000.f;
+    static constexpr float CosmeticRange = 3000.f;          // APlayerCharacter::CosmeticRange 기본값
+}
\ No newline at end of file
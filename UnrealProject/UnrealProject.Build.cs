@@ -10,6 +10,9 @@ public class UnrealProject : ModuleRules
 
         PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput", "UMG", "Slate", "SlateCore", "PlayFabGSDK", "MediaAssets" });
 
-        PrivateDependencyModuleNames.AddRange(new string[] { "HTTP", "Json", "JsonUtilities", "MoviePlayer" });
+        PrivateDependencyModuleNames.AddRange(new string[] { "HTTP", "Json", "JsonUtilities", "MoviePlayer", "AssetRegistry", "NetCore" });
+
+        // Iris 복제 빌드. 런타임 사용(net.Iris.UseIrisReplication)과 필터/우선순위 배정은 Config/DefaultEngine.ini
+        SetupIrisSupport(Target);
     }
 }
\ No newline at end of file